@@ -3,9 +3,11 @@
 
 #include <improc/improc_defs.hpp>
 #include <improc/drawer/engine/base_drawer.hpp>
+#include <improc/drawer/engine/verify_effort.hpp>
 
 #include <BitMatrix.h>
 #include <BinaryBitmap.h>
+#include <GlobalHistogramBinarizer.h>
 #include <ReaderOptions.h>
 #include <Result.h>
 #include <ThresholdBinarizer.h>
@@ -17,7 +19,9 @@
 namespace improc 
 {
     /**
-     * @brief Barcode drawer methods and utilities
+     * @brief Barcode drawer methods and utilities.
+     * Pure verification reads a single row of the drawer output, while robust verification tries harder over 
+     * several rows. Readers are kept per thread for each verify effort.
      */
     class IMPROC_API BarcodeDrawer final: public improc::BaseDrawer
     {
@@ -27,19 +31,34 @@ namespace improc
             static constexpr int                    kMargin        = 0;
             static constexpr int                    kMinWidth      = 0;
             static constexpr int                    kMinHeight     = 10;
-            static constexpr bool                   kTryHarder     = true;
+            static constexpr int                    kPureMinHeight = 1;
+            static constexpr uint8_t                kBlackThreshold = 0;
             static constexpr bool                   kDoNotRotate   = false;
-            static constexpr bool                   kNotPure       = false;
             ZXing::OneD::Code128Writer              writer_;
-            ZXing::ReaderOptions                    reader_options_;
+            improc::VerifyEffort                    verify_effort_;
             
         public:
             BarcodeDrawer();
             explicit BarcodeDrawer(const Json::Value& drawer_json);
 
             BarcodeDrawer&                          Load    (const Json::Value& drawer_json);
-            cv::Mat                                 Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>());
-            bool                                    Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>());
+            cv::Mat                                 Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            bool                                    Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            void                                    DrawInto(cv::Mat& roi, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            cv::Size                                GetOutputSize(const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            std::optional<improc::VerifyEffort>     GetVerifyEffort() const;
+
+            /**
+             * @brief Obtain verify effort
+             */
+            inline improc::VerifyEffort             get_verify_effort() const
+            {
+                return this->verify_effort_;
+            }
+
+        private:
+            static void                             RasterizeBitMatrix(const ZXing::BitMatrix& matrix_data, cv::Mat& roi);
+            static const ZXing::OneD::Reader&       GetReader(improc::VerifyEffort verify_effort);
     };
 }
 
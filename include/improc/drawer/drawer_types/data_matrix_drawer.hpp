@@ -3,21 +3,27 @@
 
 #include <improc/improc_defs.hpp>
 #include <improc/drawer/engine/base_drawer.hpp>
+#include <improc/drawer/engine/verify_effort.hpp>
 
 #include <BitMatrix.h>
 #include <BinaryBitmap.h>
 #include <DecoderResult.h>
-#include <ThresholdBinarizer.h>
+#include <HybridBinarizer.h>
+#include <ReaderOptions.h>
+#include <Result.h>
 #include <datamatrix/DMWriter.h>
 #include <datamatrix/DMSymbolShape.h>
 #include <datamatrix/DMDecoder.h>
+#include <datamatrix/DMReader.h>
 #include <codecvt>
 #include <locale>
 
 namespace improc 
 {
     /**
-     * @brief Data matrix drawer methods and utilities
+     * @brief Data matrix drawer methods and utilities.
+     * Pure verification decodes the data matrix modules directly from the drawer output, binarized in a bit matrix 
+     * kept per thread. Robust verification locates the data matrix with a reader kept per thread.
      */
     class IMPROC_API DataMatrixDrawer final: public improc::BaseDrawer
     {
@@ -27,15 +33,32 @@ namespace improc
             static constexpr int                            kMargin             = 0;
             static constexpr int                            kMinWidth           = 0;
             static constexpr int                            kMinHeight          = 0;
+            static constexpr uint8_t                        kBlackThreshold     = 0;
             ZXing::DataMatrix::Writer                       writer_;
+            improc::VerifyEffort                            verify_effort_;
             
         public:
             DataMatrixDrawer();
             explicit DataMatrixDrawer(const Json::Value& drawer_json);
 
             DataMatrixDrawer&               Load    (const Json::Value& drawer_json);
-            cv::Mat                         Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>());
-            bool                            Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>());
+            cv::Mat                         Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            bool                            Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            void                            DrawInto(cv::Mat& roi, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            cv::Size                        GetOutputSize(const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            std::optional<improc::VerifyEffort> GetVerifyEffort() const;
+
+            /**
+             * @brief Obtain verify effort
+             */
+            inline improc::VerifyEffort     get_verify_effort() const
+            {
+                return this->verify_effort_;
+            }
+
+        private:
+            static void                     RasterizeBitMatrix(const ZXing::BitMatrix& matrix_data, cv::Mat& roi);
+            static const ZXing::BitMatrix&  BinarizeImage(const cv::Mat& drawer_output);
     };
 }
 
@@ -0,0 +1,43 @@
+#ifndef IMPROC_DRAWER_FIDUCIAL_DRAWER_HPP
+#define IMPROC_DRAWER_FIDUCIAL_DRAWER_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/drawer/engine/base_drawer.hpp>
+
+#include <opencv2/core.hpp>
+#include <json/json.h>
+#include <algorithm>
+#include <cstdlib>
+
+namespace improc 
+{
+    /**
+     * @brief Fiducial marker drawer methods and utilities.
+     * The fiducial marker is a square of 7x7 modules with a dark center of 3x3 modules surrounded by a light 
+     * and a dark ring, located in scanned pages to register them with the page layout.
+     */
+    class IMPROC_API FiducialDrawer final: public improc::BaseDrawer
+    {
+        public:
+            static constexpr int    kNumberModules   = 7;
+
+        private:
+            static constexpr int    kMaxModuleErrors = 2;
+            static constexpr int    kGrayThreshold   = 128;
+
+        public:
+            FiducialDrawer();
+            explicit FiducialDrawer(const Json::Value& drawer_json);
+
+            FiducialDrawer&         Load    (const Json::Value& drawer_json);
+            cv::Mat                 Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            bool                    Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            void                    DrawInto(cv::Mat& roi, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            cv::Size                GetOutputSize(const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+
+        private:
+            static bool             IsDarkModule(int module_x, int module_y);
+    };
+}
+
+#endif
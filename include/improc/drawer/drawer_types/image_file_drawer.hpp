@@ -27,8 +27,10 @@ namespace improc
             explicit ImageFileDrawer(const Json::Value& drawer_json);
 
             ImageFileDrawer&        Load    (const Json::Value& drawer_json);
-            cv::Mat                 Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>());
-            bool                    Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>());
+            cv::Mat                 Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            bool                    Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            void                    DrawInto(cv::Mat& roi, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            cv::Size                GetOutputSize(const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
     };
 }
 
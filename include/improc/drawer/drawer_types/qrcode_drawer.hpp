@@ -2,17 +2,28 @@
 #define IMPROC_DRAWER_QRCODE_DRAWER_HPP
 
 #include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
 #include <improc/infrastructure/string.hpp>
 #include <improc/drawer/engine/base_drawer.hpp>
+#include <improc/drawer/engine/verify_effort.hpp>
+#include <improc/drawer/drawer_types/qrcode_encoder.hpp>
 
 #include <qrcodegen.hpp>
 #include <BitMatrix.h>
+#include <ByteArray.h>
 #include <BinaryBitmap.h>
 #include <DecoderResult.h>
-#include <ThresholdBinarizer.h>
+#include <HybridBinarizer.h>
+#include <ReaderOptions.h>
+#include <Result.h>
 #include <qrcode/QRDecoder.h>
-#include <codecvt>
-#include <locale>
+#include <qrcode/QRReader.h>
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace improc 
 {
@@ -79,24 +90,197 @@ namespace improc
                     }
                 }
         };
+
+        /**
+         * @brief QR-Code segment mode methods and utilities.
+         * Automatic mode chooses the most compact mode for the whole message, as the qr-code encoder does.
+         */
+        class IMPROC_API SegmentMode final
+        {
+            public:
+                enum Value : IMPROC_ENUM_KEY_TYPE
+                {
+                        kAuto         = 0
+                    ,   kNumeric      = 1
+                    ,   kAlphanumeric = 2
+                    ,   kByte         = 3
+                };
+
+            private:
+                Value                               value_;
+
+            public:
+                SegmentMode();
+                explicit SegmentMode(const std::string& segment_mode_str);
+
+                /**
+                 * @brief Construct a new improc::SegmentMode object
+                 * 
+                 * @param segment_mode_value - segment mode value
+                 */
+                constexpr explicit                  SegmentMode(Value segment_mode_value): value_(std::move(segment_mode_value)) {}
+
+                /**
+                 * @brief Obtain segment mode value
+                 */
+                constexpr operator                  Value()     const {return this->value_;}
+
+                /**
+                 * @brief Obtain segment mode string description
+                 */
+                constexpr std::string_view          ToString()  const
+                {
+                    switch (this->value_)
+                    {
+                        case SegmentMode::Value::kAuto         : return "Auto";          break;
+                        case SegmentMode::Value::kNumeric      : return "Numeric";       break;
+                        case SegmentMode::Value::kAlphanumeric : return "Alphanumeric";  break;
+                        case SegmentMode::Value::kByte         : return "Byte";          break;
+                    }
+                    return "";
+                }
+        };
+
+        /**
+         * @brief QR-Code encoder type methods and utilities
+         */
+        class IMPROC_API EncoderType final
+        {
+            public:
+                enum Value : IMPROC_ENUM_KEY_TYPE
+                {
+                        kQrCodeGen = 0
+                    ,   kBuiltin   = 1
+                };
+
+            private:
+                Value                               value_;
+
+            public:
+                EncoderType();
+                explicit EncoderType(const std::string& encoder_type_str);
+
+                /**
+                 * @brief Construct a new improc::EncoderType object
+                 * 
+                 * @param encoder_type_value - encoder type value
+                 */
+                constexpr explicit                  EncoderType(Value encoder_type_value): value_(std::move(encoder_type_value)) {}
+
+                /**
+                 * @brief Obtain encoder type value
+                 */
+                constexpr operator                  Value()     const {return this->value_;}
+
+                /**
+                 * @brief Obtain encoder type string description
+                 */
+                constexpr std::string_view          ToString()  const
+                {
+                    switch (this->value_)
+                    {
+                        case EncoderType::Value::kQrCodeGen : return "QrCodeGen";  break;
+                        case EncoderType::Value::kBuiltin   : return "Built-in";   break;
+                    }
+                    return "";
+                }
+        };
     };
 
     /**
-     * @brief QR-Code drawer methods and utilities
+     * @brief QR-Code drawer methods and utilities.
+     * Pure verification decodes the qr-code modules directly from the drawer output, binarized in a bit matrix 
+     * kept per thread. Robust verification locates the qr-code with a reader kept per thread.
+     * The version range, the mask and the segment mode can be pinned, so the qr-code keeps the same size for 
+     * every message and the mask penalty search is skipped. Messages with unsigned integer payloads are encoded 
+     * as a sequence of character indexes, in the numeric or alphanumeric character set.
+     * The built-in encoder produces the same qr-codes as the qrcodegen encoder, without allocating while encoding.
      */
     class IMPROC_API QrCodeDrawer final: public improc::BaseDrawer
     {
         private:
             static constexpr ZXing::ImageFormat     kImageFormat   = ZXing::ImageFormat::Lum;
+            static constexpr uint8_t                kBlackThreshold = 0;
+            static constexpr int                    kAutoMask       = -1;
+            static constexpr int                    kNumberMasks    = 8;
             improc::qrcode::ErrorCorrectionLevel    error_correction_level_;
+            improc::VerifyEffort                    verify_effort_;
+            improc::qrcode::SegmentMode             segment_mode_;
+            int                                     min_version_;
+            int                                     max_version_;
+            std::optional<int>                      mask_;
+            improc::qrcode::EncoderType             encoder_type_;
             
         public:
             QrCodeDrawer();
             explicit QrCodeDrawer(const Json::Value& drawer_json);
 
             QrCodeDrawer&                           Load    (const Json::Value& drawer_json);
-            cv::Mat                                 Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>());
-            bool                                    Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>());
+            cv::Mat                                 Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            bool                                    Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            void                                    DrawInto(cv::Mat& roi, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            cv::Size                                GetOutputSize(const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            std::optional<improc::VerifyEffort>     GetVerifyEffort() const;
+
+            /**
+             * @brief Obtain verify effort
+             */
+            inline improc::VerifyEffort             get_verify_effort() const
+            {
+                return this->verify_effort_;
+            }
+
+            /**
+             * @brief Obtain segment mode
+             */
+            inline improc::qrcode::SegmentMode      get_segment_mode()  const
+            {
+                return this->segment_mode_;
+            }
+
+            /**
+             * @brief Obtain minimum qr-code version
+             */
+            inline int                              get_min_version()   const
+            {
+                return this->min_version_;
+            }
+
+            /**
+             * @brief Obtain maximum qr-code version
+             */
+            inline int                              get_max_version()   const
+            {
+                return this->max_version_;
+            }
+
+            /**
+             * @brief Obtain pinned qr-code mask, empty if the mask is chosen by penalty score
+             */
+            inline std::optional<int>               get_mask()          const
+            {
+                return this->mask_;
+            }
+
+            /**
+             * @brief Obtain qr-code encoder type
+             */
+            inline improc::qrcode::EncoderType      get_encoder_type()  const
+            {
+                return this->encoder_type_;
+            }
+
+        private:
+            qrcodegen::QrCode                       Encode          (const std::optional<DrawerVariant>& message) const;
+            const improc::qrcode::QrCodeEncoder&    EncodeBuiltin   (const std::optional<DrawerVariant>& message) const;
+            std::vector<qrcodegen::QrSegment>       MakeSegments    (const std::optional<DrawerVariant>& message) const;
+            std::pair<const qrcodegen::QrSegment::Mode*,std::string_view> GetSegment(const std::optional<DrawerVariant>& message) const;
+            std::string_view                        GetMessageText  (const std::optional<DrawerVariant>& message) const;
+
+            static void                             RasterizeQrCode(const qrcodegen::QrCode& qrcode_data, cv::Mat& roi);
+            static void                             RasterizeQrCode(const improc::qrcode::QrCodeEncoder& qrcode_data, cv::Mat& roi);
+            static const ZXing::BitMatrix&          BinarizeImage(const cv::Mat& drawer_output);
+            static bool                             HasMessageBytes(const ZXing::ByteArray& decoded_bytes, std::string_view message_text);
     };
 }
 
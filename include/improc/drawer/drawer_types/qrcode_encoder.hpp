@@ -0,0 +1,147 @@
+#ifndef IMPROC_DRAWER_QRCODE_ENCODER_HPP
+#define IMPROC_DRAWER_QRCODE_ENCODER_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/drawer/logger_drawer.hpp>
+
+#include <qrcodegen.hpp>
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace improc
+{
+    namespace qrcode
+    {
+        /**
+         * @brief Built-in qr-code encoder methods and utilities.
+         * This encoder produces the same symbols as the qrcodegen encoder for a single segment message, using
+         * fixed size storage so that encoding does not allocate. Modules are packed in 64-bit words, one line
+         * per row and one line per column, so masks are applied and penalty scores are evaluated one word at a
+         * time. Reed-Solomon error correction uses a precomputed multiplication table of GF(256).
+         * An encoder keeps the last encoded symbol, so it should not be shared between threads.
+         */
+        class IMPROC_API QrCodeEncoder final
+        {
+            public:
+                static constexpr int                kMaxSize      = 4 * qrcodegen::QrCode::MAX_VERSION + 17;
+
+            private:
+                static constexpr int                kWordBits     = 64;
+                static constexpr int                kLineWords    = (kMaxSize + kWordBits - 1) / kWordBits;
+                static constexpr int                kMaxCodewords = 3706;
+                static constexpr int                kMaskPeriod   = 12;
+                static constexpr int                kNumberMasks  = 8;
+                static constexpr int                kAutoMask     = -1;
+                static constexpr long               kPenaltyN1    = 3;
+                static constexpr long               kPenaltyN2    = 3;
+                static constexpr long               kPenaltyN3    = 40;
+                static constexpr long               kPenaltyN4    = 10;
+
+                typedef std::array<uint64_t,kLineWords>                         ModuleLine;
+                typedef std::array<ModuleLine,kMaxSize>                         ModuleMatrix;
+                typedef std::array<std::array<ModuleLine,kMaskPeriod>,kNumberMasks> MaskTable;
+
+                int                                 version_;
+                int                                 size_;
+                int                                 mask_;
+                qrcodegen::QrCode::Ecc              error_correction_level_;
+                ModuleLine                          valid_modules_;
+                ModuleMatrix                        rows_;
+                ModuleMatrix                        columns_;
+                ModuleMatrix                        function_rows_;
+                ModuleMatrix                        function_columns_;
+                std::array<uint8_t,kMaxCodewords>   data_codewords_;
+                std::array<uint8_t,kMaxCodewords>   codewords_;
+
+            public:
+                QrCodeEncoder();
+
+                QrCodeEncoder&                      Encode  ( std::string_view segment_data, const qrcodegen::QrSegment::Mode* segment_mode
+                                                            , qrcodegen::QrCode::Ecc error_correction_level
+                                                            , int min_version = qrcodegen::QrCode::MIN_VERSION, int max_version = qrcodegen::QrCode::MAX_VERSION
+                                                            , int mask = kAutoMask );
+
+                /**
+                 * @brief Obtain module color of the last encoded qr-code
+                 *
+                 * @param module_x - module column
+                 * @param module_y - module row
+                 * @return bool - true if module is dark, false otherwise.
+                 */
+                inline bool                         GetModule(int module_x, int module_y) const
+                {
+                    return ((this->rows_[module_y][module_x / kWordBits] >> (module_x % kWordBits)) & 1U) != 0;
+                }
+
+                /**
+                 * @brief Obtain version of the last encoded qr-code
+                 */
+                inline int                          get_version() const
+                {
+                    return this->version_;
+                }
+
+                /**
+                 * @brief Obtain size in modules of the last encoded qr-code
+                 */
+                inline int                          get_size() const
+                {
+                    return this->size_;
+                }
+
+                /**
+                 * @brief Obtain mask of the last encoded qr-code
+                 */
+                inline int                          get_mask() const
+                {
+                    return this->mask_;
+                }
+
+                /**
+                 * @brief Obtain error correction level of the last encoded qr-code, after being boosted
+                 */
+                inline qrcodegen::QrCode::Ecc       get_error_correction_level() const
+                {
+                    return this->error_correction_level_;
+                }
+
+                static int                          GetTotalBits(std::string_view segment_data, const qrcodegen::QrSegment::Mode* segment_mode, int version);
+                static int                          GetNumDataCodewords(int version, qrcodegen::QrCode::Ecc error_correction_level);
+
+            private:
+                void                                WriteDataCodewords(std::string_view segment_data, const qrcodegen::QrSegment::Mode* segment_mode);
+                void                                AddErrorCorrection();
+                void                                DrawFunctionPatterns();
+                void                                DrawFinderPattern(int center_x, int center_y);
+                void                                DrawAlignmentPattern(int center_x, int center_y);
+                void                                DrawFormatBits(int mask);
+                void                                DrawVersion();
+                void                                DrawCodewords();
+                void                                ApplyMask(int mask);
+                void                                SetFunctionModule(int module_x, int module_y, bool is_dark);
+                long                                GetPenaltyScore() const;
+                long                                GetLinePenalty(const ModuleLine& line) const;
+                int                                 GetNextRunStart(const ModuleLine& line, int module_idx, bool is_dark) const;
+                void                                AddRunHistory(int run_length, std::array<int,7>& run_history) const;
+
+                static int                          CountFinderPatterns(const std::array<int,7>& run_history);
+                static int                          GetNumRawDataModules(int version);
+                static int                          CountTrailingZeros(uint64_t word);
+                static const MaskTable&             GetMaskRows();
+                static const MaskTable&             GetMaskColumns();
+                static bool                         IsMaskedModule(int mask, int module_x, int module_y);
+        };
+    }
+}
+
+#endif
@@ -10,33 +10,49 @@
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
 
 namespace improc 
 {
     /**
-     * @brief Text drawer methods and utilities
+     * @brief Text drawer methods and utilities. 
+     * The font file content is loaded once and shared by the drawer copies. Each thread drawing text 
+     * creates its own FreeType library and face from the font content, since FreeType faces cannot 
+     * be used concurrently.
      */
     class IMPROC_API TextDrawer final: public improc::BaseDrawer
     {
+        public:
+            /**
+             * @brief Font file content shared by text drawer copies
+             */
+            struct FontContent
+            {
+                std::shared_ptr<const std::vector<FT_Byte>> data;
+            };
+
         private:
-            static constexpr unsigned int   kFontSizePointFraction = 64; 
-            static constexpr unsigned int   kLoadFirstFont         = 0; 
-            bool                            font_loaded_;
-            FT_Library                      library_;
-            FT_Face                         face_;
-            cv::Size                        image_text_size_;
-            unsigned int                    printing_resolution_;
-            unsigned int                    font_size_;
+            static constexpr unsigned int               kFontSizePointFraction = 64; 
+            static constexpr unsigned int               kLoadFirstFont         = 0; 
+            std::shared_ptr<const FontContent>          font_content_;
+            cv::Size                                    image_text_size_;
+            unsigned int                                printing_resolution_;
+            unsigned int                                font_size_;
             
         public:
             TextDrawer();
             explicit TextDrawer(const Json::Value& drawer_json);
 
             TextDrawer&                     Load    (const Json::Value& drawer_json);
-            cv::Mat                         Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>());
-            bool                            Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) {return true;};
+            cv::Mat                         Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            bool                            Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const {return true;};
+            void                            DrawInto(cv::Mat& roi, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            cv::Size                        GetOutputSize(const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
 
         private:
+            FT_Face                         GetFontFace() const;
             static cv::Size                 ParseMetricSize(const Json::Value& size_json, const improc::MetricPixelConverter& pixel_converter);
     };
 }
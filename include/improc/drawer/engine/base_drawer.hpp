@@ -4,22 +4,90 @@
 #include <improc/improc_defs.hpp>
 #include <improc/exception.hpp>
 #include <improc/drawer/logger_drawer.hpp>
+#include <improc/drawer/engine/verify_effort.hpp>
 #include <improc/services/factory/factory_pattern.hpp>
 #include <improc/infrastructure/parsers/json_parser.hpp>
 
 #include <opencv2/core.hpp>
 #include <json/json.h>
+#include <cstdint>
 #include <functional>
 #include <optional>
+#include <string_view>
+#include <vector>
 
 namespace improc 
 {
     typedef std::variant<std::string,std::vector<std::byte>,std::vector<unsigned int>> DrawerVariant;
 
+    /**
+     * @brief Read-only view of contiguous elements owned by the caller
+     * 
+     * @tparam ElementType - data type of elements
+     */
+    template <typename ElementType>
+    class ConstSpan final
+    {
+        private:
+            const ElementType*  data_;
+            size_t              size_;
+
+        public:
+            /**
+             * @brief Construct a new empty improc::ConstSpan object
+             */
+            constexpr ConstSpan() : data_(nullptr), size_(0) {}
+
+            /**
+             * @brief Construct a new improc::ConstSpan object
+             * 
+             * @param data - pointer to first element
+             * @param size - number of elements
+             */
+            constexpr ConstSpan(const ElementType* data, size_t size) : data_(data), size_(size) {}
+
+            /**
+             * @brief Construct a new improc::ConstSpan object viewing the elements of a vector
+             * 
+             * @param elements - vector with elements, which must outlive the span
+             */
+            ConstSpan(const std::vector<ElementType>& elements) : data_(elements.data()), size_(elements.size()) {}
+
+            inline const ElementType*   begin()     const {return this->data_;}
+            inline const ElementType*   end()       const {return this->data_ + this->size_;}
+            inline const ElementType*   data()      const {return this->data_;}
+            inline size_t               size()      const {return this->size_;}
+            inline bool                 empty()     const {return this->size_ == 0;}
+            inline const ElementType&   operator[](size_t idx) const {return this->data_[idx];}
+    };
+
+    /**
+     * @brief Drawer message borrowing its payload from the caller. 
+     * It is the non-owning counterpart of DrawerVariant.
+     */
+    typedef std::variant<std::string_view,ConstSpan<std::byte>,ConstSpan<unsigned int>> DrawerVariantView;
+
+    /**
+     * @brief Page context borrowing its messages from the caller, with one optional message per page element. 
+     * Element drawers take owned messages, so the payload of every dynamic page element is copied to message storage 
+     * kept per thread each time a page is drawn or verified. The view spares the caller from building owned messages, 
+     * but it is not zero-copy.
+     */
+    typedef ConstSpan<std::optional<DrawerVariantView>> DrawerContextView;
+
     class DrawerFactory;
 
     /**
-     * @brief Base drawer object for drawer factory
+     * @brief Base drawer object for drawer factory. 
+     * Draw and Verify are const and reentrant, so a loaded drawer can be shared by several element drawers 
+     * and called concurrently from several threads. Native state that is not thread-safe is kept per thread 
+     * by the drawer implementation.
+     * DrawInto writes the drawer output directly in a region of a larger image. Drawers override it to avoid 
+     * allocating an intermediate output image. GetOutputSize obtains the size of the drawer output without drawing,
+     * and drawers override it whenever the size can be computed without rendering. GetVerifyEffort obtains the 
+     * verify effort of symbol drawers, and is empty for drawers that do not decode symbols.
+     * HashMessage obtains a FNV-1a hash of the message type and payload, and HashBytes adds bytes to a FNV-1a 
+     * hash started from kHashOffsetBasis, so every hash of the library is computed the same way.
      */
     // TODO: Allow to use cv::MatExpr in the verify method
     class IMPROC_API BaseDrawer
@@ -28,16 +96,26 @@ namespace improc
             static constexpr int    kImageDataType = CV_8UC1;
             static constexpr int    kBlackValue    = 0;
             static constexpr int    kWhiteValue    = 255;
+            static constexpr std::uint64_t kHashOffsetBasis = 0xcbf29ce484222325ULL;
 
         public:
             BaseDrawer();
             explicit BaseDrawer(const Json::Value& drawer_json);
+            virtual ~BaseDrawer() = default;
 
             virtual BaseDrawer&     Load    (const Json::Value& drawer_json) = 0;
-            virtual cv::Mat         Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) = 0;
-            virtual bool            Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) = 0;
+            virtual cv::Mat         Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const = 0;
+            virtual bool            Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const = 0;
+            virtual void            DrawInto(cv::Mat& roi, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            virtual cv::Size        GetOutputSize(const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            virtual std::optional<VerifyEffort> GetVerifyEffort() const;
 
             static std::shared_ptr<BaseDrawer> Create(const DrawerFactory& factory, const Json::Value& drawer_json);
+            static std::uint64_t    HashMessage(const std::optional<DrawerVariant>& message);
+            static std::uint64_t    HashBytes(std::uint64_t hash, const void* data, size_t number_bytes);
+
+        protected:
+            static void             ValidateRoi(const cv::Mat& roi, const cv::Size& output_size);
     };
 
     /**
@@ -0,0 +1,266 @@
+#ifndef IMPROC_DRAWER_BOUNDED_QUEUE_HPP
+#define IMPROC_DRAWER_BOUNDED_QUEUE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/drawer/logger_drawer.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace improc
+{
+    /**
+     * @brief Bounded queue methods and utilities.
+     * This class is a fixed capacity, lock-free queue for multiple producers and multiple consumers. Each cell
+     * of the ring buffer has a sequence number telling producers and consumers whether the cell can be written
+     * or read, so elements are pushed and popped without locks.
+     * Blocking push and pop wait on condition variables instead of spinning, and closing the queue wakes every
+     * waiting thread. Successful pushes and pops only lock to notify the opposite side.
+     *
+     * @tparam ElementType - data type of queue elements
+     */
+    template <typename ElementType>
+    class BoundedQueue final
+    {
+        private:
+            /**
+             * @brief Ring buffer cell with sequence number
+             */
+            struct Cell
+            {
+                std::atomic<size_t>         sequence;
+                std::optional<ElementType>  element;
+            };
+
+            std::unique_ptr<Cell[]>         cells_;
+            size_t                          capacity_;
+            std::atomic<size_t>             push_position_;
+            std::atomic<size_t>             pop_position_;
+            std::mutex                      wait_mutex_;
+            std::condition_variable         not_empty_condition_;
+            std::condition_variable         not_full_condition_;
+            bool                            closed_;
+
+        public:
+            /**
+             * @brief Construct a new improc::BoundedQueue object
+             *
+             * @param capacity - maximum number of elements in queue
+             */
+            explicit BoundedQueue(size_t capacity) : cells_(nullptr)
+                                                   , capacity_(capacity)
+                                                   , push_position_(0)
+                                                   , pop_position_(0)
+                                                   , closed_(false)
+            {
+                IMPROC_DRAWER_LOGGER_TRACE("Creating bounded queue...");
+                if (capacity == 0)
+                {
+                    std::string error_message = "Bounded queue capacity should be greater than zero";
+                    IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+                    throw improc::value_error(std::move(error_message));
+                }
+
+                this->cells_ = std::make_unique<Cell[]>(capacity);
+                for (size_t cell_idx = 0; cell_idx < capacity; cell_idx++)
+                {
+                    this->cells_[cell_idx].sequence.store(cell_idx,std::memory_order_relaxed);
+                }
+            }
+
+            BoundedQueue(const BoundedQueue&  that) = delete;
+            BoundedQueue(BoundedQueue&&       that) = delete;
+            BoundedQueue& operator=(const BoundedQueue&  that) = delete;
+            BoundedQueue& operator=(BoundedQueue&&       that) = delete;
+
+            /**
+             * @brief Push element to queue if queue is not full
+             *
+             * @param element - element to push, only moved if pushed
+             * @return bool - true if element was pushed, false if queue is full
+             */
+            bool                        TryPush(ElementType&& element)
+            {
+                if (this->PushElement(std::move(element)) == false)
+                {
+                    return false;
+                }
+                this->Notify(this->not_empty_condition_);
+                return true;
+            }
+
+            /**
+             * @brief Pop element from queue if queue is not empty
+             *
+             * @return std::optional<ElementType> - element popped, empty if queue is empty
+             */
+            std::optional<ElementType>  TryPop()
+            {
+                std::optional<ElementType> element = this->PopElement();
+                if (element.has_value() == true)
+                {
+                    this->Notify(this->not_full_condition_);
+                }
+                return element;
+            }
+
+            /**
+             * @brief Push element to queue, waiting while queue is full
+             *
+             * @param element - element to push, only moved if pushed
+             * @return bool - true if element was pushed, false if queue was closed
+             */
+            bool                        Push(ElementType&& element)
+            {
+                {
+                    std::unique_lock<std::mutex> lock {this->wait_mutex_};
+                    bool is_pushed = false;
+                    this->not_full_condition_.wait(lock,[this,&element,&is_pushed] () 
+                        {
+                            return this->closed_ == true || (is_pushed = this->PushElement(std::move(element))) == true;
+                        }
+                    );
+                    if (is_pushed == false)
+                    {
+                        return false;
+                    }
+                }
+                this->not_empty_condition_.notify_one();
+                return true;
+            }
+
+            /**
+             * @brief Pop element from queue, waiting while queue is empty and not closed
+             *
+             * @return std::optional<ElementType> - element popped, empty if queue is closed and empty
+             */
+            std::optional<ElementType>  Pop()
+            {
+                std::optional<ElementType> element {};
+                {
+                    std::unique_lock<std::mutex> lock {this->wait_mutex_};
+                    this->not_empty_condition_.wait(lock,[this,&element] () 
+                        {
+                            element = this->PopElement();
+                            return element.has_value() == true || this->closed_ == true;
+                        }
+                    );
+                }
+                if (element.has_value() == true)
+                {
+                    this->not_full_condition_.notify_one();
+                }
+                return element;
+            }
+
+            /**
+             * @brief Close queue, waking every thread waiting to push or pop. 
+             * Elements already in queue can still be popped, while later pushes fail.
+             */
+            void                        Close()
+            {
+                {
+                    std::lock_guard<std::mutex> lock {this->wait_mutex_};
+                    this->closed_ = true;
+                }
+                this->not_empty_condition_.notify_all();
+                this->not_full_condition_.notify_all();
+            }
+
+            /**
+             * @brief Obtain maximum number of elements in queue
+             */
+            inline size_t               get_capacity() const
+            {
+                return this->capacity_;
+            }
+
+        private:
+            /**
+             * @brief Notify a thread waiting on a condition of queue. 
+             * The wait mutex is taken so that a waiting thread cannot miss the change between checking the queue and waiting.
+             *
+             * @param condition - condition to notify
+             */
+            void                        Notify(std::condition_variable& condition)
+            {
+                {
+                    std::lock_guard<std::mutex> lock {this->wait_mutex_};
+                }
+                condition.notify_one();
+            }
+
+            /**
+             * @brief Push element to ring buffer without waiting
+             *
+             * @param element - element to push, only moved if pushed
+             * @return bool - true if element was pushed, false if queue is full
+             */
+            bool                        PushElement(ElementType&& element)
+            {
+                size_t position = this->push_position_.load(std::memory_order_relaxed);
+                while (true)
+                {
+                    Cell&  cell     = this->cells_[position % this->capacity_];
+                    size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                    if (sequence == position)
+                    {
+                        if (this->push_position_.compare_exchange_weak(position,position + 1,std::memory_order_relaxed) == true)
+                        {
+                            cell.element = std::move(element);
+                            cell.sequence.store(position + 1,std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (sequence < position)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = this->push_position_.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            /**
+             * @brief Pop element from ring buffer without waiting
+             *
+             * @return std::optional<ElementType> - element popped, empty if queue is empty
+             */
+            std::optional<ElementType>  PopElement()
+            {
+                size_t position = this->pop_position_.load(std::memory_order_relaxed);
+                while (true)
+                {
+                    Cell&  cell     = this->cells_[position % this->capacity_];
+                    size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                    if (sequence == position + 1)
+                    {
+                        if (this->pop_position_.compare_exchange_weak(position,position + 1,std::memory_order_relaxed) == true)
+                        {
+                            std::optional<ElementType> element = std::move(cell.element);
+                            cell.element.reset();
+                            cell.sequence.store(position + this->capacity_,std::memory_order_release);
+                            return element;
+                        }
+                    }
+                    else if (sequence < position + 1)
+                    {
+                        return std::optional<ElementType>();
+                    }
+                    else
+                    {
+                        position = this->pop_position_.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+    };
+}
+
+#endif
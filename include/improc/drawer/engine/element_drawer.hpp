@@ -6,23 +6,44 @@
 #include <improc/corecv/structures/rotation_type.hpp>
 #include <improc/corecv/parsers/json_parser.hpp>
 #include <improc/drawer/engine/base_drawer.hpp>
+#include <improc/drawer/engine/render_cache.hpp>
 
 #include <opencv2/imgproc.hpp>
 #include <json/json.h>
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <string>
 
 namespace improc 
 {
     /**
      * @brief Element drawer object for drawer factory. 
      * This class applies a rotation and a resizing operation to a base drawer. 
+     * The rotation is applied to the base drawer output at module resolution, and the resizing expands each 
+     * module directly into its scaled block of the element image.
+     * An element drawer can use a render cache to memoise its element images, rotated and resized, keyed by 
+     * a hash of the element configuration and of the message and checked against both. Element drawers with 
+     * the same configuration can share a render cache, so repeated messages are copied from the cache instead 
+     * of drawn again.
+     * Verifying with a known scale factor, obtained when allocating, does not draw the element again. The element 
+     * image is verified in place when it is neither rotated nor resized, and is otherwise reduced to its native 
+     * size in an image kept per thread and reused.
+     * With exact verification, the element image is first compared with the expected element image, taken from the 
+     * render cache or drawn in an image kept per thread. The base drawer only decodes the element image when the 
+     * number of different pixels is greater than the configured tolerance.
      */
     class IMPROC_API ElementDrawer
     {
         private:
-            std::shared_ptr<BaseDrawer> drawer_;
-            std::optional<RotationType> rotation_;
-            std::optional<cv::Size>     size_;
+            std::shared_ptr<const BaseDrawer> drawer_;
+            std::optional<RotationType>       rotation_;
+            std::optional<cv::Size>           size_;
+            std::string                       drawer_type_;
+            std::uint64_t                     element_key_;
+            std::shared_ptr<const std::string> element_config_;
+            std::shared_ptr<RenderCache>      render_cache_;
+            std::optional<size_t>             exact_tolerance_;
 
         public:
             ElementDrawer();
@@ -31,9 +52,74 @@ namespace improc
             ElementDrawer&              Load    (const improc::DrawerFactory& factory, const Json::Value& element_drawer_json);
             cv::Mat                     Draw    (const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
             bool                        Verify  (const cv::Mat& drawer_output, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            bool                        Verify  (const cv::Mat& element_image, unsigned int element_scale, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            void                        DrawInto(cv::Mat& roi, const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            cv::Size                    GetOutputSize(const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            cv::Size                    GetNativeSize(const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
+            unsigned int                GetScaleFactor(const cv::Size& native_size) const;
+            unsigned int                GetScaleFactor(const cv::Size& element_size, unsigned int element_scale, const std::optional<DrawerVariant>& message) const;
+            bool                        IsSameElement(const ElementDrawer& element_drawer) const;
+
+            /**
+             * @brief Obtain drawer type of base drawer
+             */
+            inline const std::string&   get_drawer_type()   const
+            {
+                return this->drawer_type_;
+            }
+
+            /**
+             * @brief Obtain base drawer, null if element drawer is not loaded
+             */
+            inline std::shared_ptr<const BaseDrawer> get_drawer() const
+            {
+                return this->drawer_;
+            }
+
+            /**
+             * @brief Obtain rotation applied to the base drawer output, empty if not rotated
+             */
+            inline std::optional<RotationType> get_rotation() const
+            {
+                return this->rotation_;
+            }
+
+            /**
+             * @brief Obtain maximum number of different pixels accepted by exact verification, empty if exact verification is disabled
+             */
+            inline std::optional<size_t> get_exact_tolerance() const
+            {
+                return this->exact_tolerance_;
+            }
+
+            /**
+             * @brief Obtain render cache of element drawer, null if element images are not cached
+             */
+            inline std::shared_ptr<RenderCache> get_render_cache() const
+            {
+                return this->render_cache_;
+            }
+
+            /**
+             * @brief Set render cache of element drawer
+             * 
+             * @param render_cache - render cache for element images, null to disable caching
+             */
+            inline ElementDrawer&       set_render_cache(const std::shared_ptr<RenderCache>& render_cache)
+            {
+                this->render_cache_ = render_cache;
+                return (*this);
+            }
 
         private:
+            cv::Mat                     DrawElement         (const std::optional<DrawerVariant>& message) const;
+            void                        DrawElementInto     (cv::Mat& roi, const std::optional<DrawerVariant>& message) const;
+            std::uint64_t               GetCacheKey         (const std::optional<DrawerVariant>& message) const;
+            bool                        IsExactElement      (const cv::Mat& element_image, unsigned int element_scale, const std::optional<DrawerVariant>& message) const;
+
             static unsigned int         GetScale(const cv::Size& current_size, const cv::Size& expected_size);
+            static void                 ScaleInto(const cv::Mat& drawer_output, unsigned int scale, cv::Mat& element_image);
+            static size_t               CountDifferentPixels(const cv::Mat& element_image, const cv::Mat& expected_image, size_t max_differences);
     };
 }
 
@@ -14,17 +14,33 @@ namespace improc
     /**
      * @brief Grid drawer object for drawer factory. 
      * This is an utility class to define a grid of page element drawers in a page.
+     * The page elements of a cell are kept as a template, so loading only counts the cell page elements, which are 
+     * created when allocating. Element sizes and the static elements raster are computed once per cell and stamped to every cell offset.
+     * Identifiers of cell page elements are qualified with the cell position in the grid, as in id[x,y].
      */
     class IMPROC_API GridDrawer final: public improc::PageDrawer
     {
+        private:
+            std::vector<PageElementDrawer>  cell_elements_;
+            cv::Size                        cell_size_;
+            cv::Point                       grid_number_;
+            std::vector<cv::Point>          cell_offsets_;
+
         public:
             GridDrawer();
             explicit GridDrawer(const improc::DrawerFactory& factory, const Json::Value& grid_drawer_json);
 
             GridDrawer&         Load    (const improc::DrawerFactory& factory, const Json::Value& grid_drawer_json);
             GridDrawer&         Allocate();
+            GridDrawer&         Allocate(const improc::RenderPlanCache& render_plan_cache);
 
         private:
+            GridDrawer&                     AppendCellSlots();
+            GridDrawer&                     AppendCellElements();
+            GridDrawer&                     AllocateCells();
+            std::vector<PageElementDrawer>  CreateCellElements(size_t cell_idx) const;
+            std::string                     GetCellElementId  (const std::string& element_id, size_t cell_idx) const;
+
             static cv::Point    ParseGridNumber (const Json::Value& grid_number_json);
             static cv::Point    ParseGridSpacing(const Json::Value& grid_spacing_json);
             static inline bool  IsNumberValid   (int number);
@@ -0,0 +1,96 @@
+#ifndef IMPROC_DRAWER_PAGE_BUFFER_POOL_HPP
+#define IMPROC_DRAWER_PAGE_BUFFER_POOL_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/drawer/logger_drawer.hpp>
+
+#include <opencv2/core.hpp>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace improc
+{
+    class PageBufferPool;
+
+    /**
+     * @brief Pooled page methods and utilities.
+     * This class owns a page image obtained from a page buffer pool and gives it back to the pool when destroyed.
+     * The page image is only given back if no other matrix header references its data, so headers copied
+     * from the page image remain valid after the pooled page is destroyed.
+     */
+    class IMPROC_API PooledPage final
+    {
+        friend class PageBufferPool;
+
+        private:
+            /**
+             * @brief Idle page buffers shared between a page buffer pool and its pooled pages
+             */
+            struct Buffers
+            {
+                std::mutex              mutex;
+                std::vector<cv::Mat>    idle;
+                size_t                  max_idle;
+            };
+
+            cv::Mat                     page_image_;
+            std::weak_ptr<Buffers>      buffers_;
+
+        public:
+            PooledPage();
+            ~PooledPage();
+
+            PooledPage(const PooledPage&  that) = delete;
+            PooledPage(PooledPage&&       that);
+            PooledPage& operator=(const PooledPage&  that) = delete;
+            PooledPage& operator=(PooledPage&&       that);
+
+            void                        Release();
+
+            /**
+             * @brief Obtain page image. 
+             * The page image is only given as a constant reference, so it cannot be reallocated and given back to the pool
+             * with a different size or data type. Pixels are written through a matrix header copied from it.
+             */
+            inline const cv::Mat&       get_page_image() const
+            {
+                return this->page_image_;
+            }
+
+        private:
+            explicit PooledPage(cv::Mat&& page_image, const std::shared_ptr<Buffers>& buffers);
+    };
+
+    /**
+     * @brief Page buffer pool methods and utilities.
+     * This class keeps page images released by pooled pages so they can be reused by later pages with the
+     * same size and data type, avoiding page-sized allocations in steady state. The pool can be shared
+     * between threads and pooled pages may outlive the pool. The number of idle page images is bounded, so
+     * released page images beyond the limit are freed.
+     */
+    class IMPROC_API PageBufferPool final
+    {
+        public:
+            static constexpr size_t                 kDefaultMaxIdleBuffers = 16;
+
+        private:
+            std::shared_ptr<PooledPage::Buffers>    buffers_;
+
+        public:
+            PageBufferPool();
+            explicit PageBufferPool(size_t max_idle_buffers);
+
+            PageBufferPool(const PageBufferPool&  that) = delete;
+            PageBufferPool(PageBufferPool&&       that) = delete;
+            PageBufferPool& operator=(const PageBufferPool&  that) = delete;
+            PageBufferPool& operator=(PageBufferPool&&       that) = delete;
+
+            PooledPage                  Acquire(const cv::Size& page_size, int data_type);
+
+            size_t                      get_number_idle_buffers() const;
+    };
+}
+
+#endif
@@ -5,23 +5,39 @@
 #include <improc/exception.hpp>
 #include <improc/corecv/parsers/json_parser.hpp>
 #include <improc/drawer/engine/page_element_drawer.hpp>
+#include <improc/drawer/engine/worker_pool.hpp>
+#include <improc/drawer/engine/page_buffer_pool.hpp>
+#include <improc/drawer/engine/render_plan.hpp>
+#include <improc/drawer/engine/render_plan_cache.hpp>
 
 #include <opencv2/core.hpp>
 #include <json/json.h>
 #include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace improc 
 {
     /**
      * @brief Page drawer object for drawer factory. 
      * This class defines page element drawers within a page.
+     * When allocated, the page is compiled in an immutable render plan used by every draw and verify method.
      */
     class IMPROC_API PageDrawer
     {
         protected:
-            std::list<PageElementDrawer>        elements_;
+            std::vector<PageElementDrawer>      elements_;
+            size_t                              number_elements_;
             cv::Size                            page_size_;
             cv::Mat                             page_image_;
+            std::shared_ptr<const RenderPlan>   render_plan_;
+            std::unordered_map<std::string,size_t>      element_slots_;
+            std::vector<std::optional<DrawerVariant>>   slot_messages_;
+            bool                                        has_slot_messages_;
+            bool                                        incremental_draw_;
+            std::vector<size_t>                         skip_counters_;
 
         public:
             PageDrawer();
@@ -29,9 +45,26 @@ namespace improc
 
             PageDrawer&                         Load    (const improc::DrawerFactory& factory, const Json::Value& page_drawer_json);
             PageDrawer&                         Allocate();
+            PageDrawer&                         Allocate(const improc::RenderPlanCache& render_plan_cache);
             cv::Mat                             Draw    (const std::list<std::optional<DrawerVariant>>& context = std::list<std::optional<DrawerVariant>>());
+            cv::Mat                             Draw    (const std::list<std::optional<DrawerVariant>>& context, improc::WorkerPool& worker_pool);
+            void                                Draw    (cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context) const;
+            improc::PooledPage                  Draw    (improc::PageBufferPool& page_buffer_pool, const std::list<std::optional<DrawerVariant>>& context) const;
+            std::vector<cv::Mat>                DrawBatch(const std::vector<std::list<std::optional<DrawerVariant>>>& contexts) const;
+            std::vector<cv::Mat>                DrawBatch(const std::vector<std::list<std::optional<DrawerVariant>>>& contexts, improc::WorkerPool& worker_pool) const;
             bool                                Verify  (const std::list<std::optional<DrawerVariant>>& context = std::list<std::optional<DrawerVariant>>());
-            bool                                Verify  (const cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context = std::list<std::optional<DrawerVariant>>());
+            bool                                Verify  (const cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context = std::list<std::optional<DrawerVariant>>()) const;
+            void                                Draw    (cv::Mat& page_image, const DrawerContextView& context) const;
+            improc::PooledPage                  Draw    (improc::PageBufferPool& page_buffer_pool, const DrawerContextView& context) const;
+            bool                                Verify  (const cv::Mat& page_image, const DrawerContextView& context) const;
+            VerificationReport                  Verify  (const std::list<std::optional<DrawerVariant>>& context, improc::WorkerPool& worker_pool, VerificationPolicy policy = VerificationPolicy::kFullReport) const;
+            VerificationReport                  Verify  (const cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context, improc::WorkerPool& worker_pool, VerificationPolicy policy = VerificationPolicy::kFullReport) const;
+            cv::Mat                             DrawSlots(const std::vector<std::pair<size_t,std::optional<DrawerVariant>>>& slot_context);
+            cv::Mat                             DrawSlots(const std::unordered_map<std::string,std::optional<DrawerVariant>>& element_context);
+            size_t                              GetElementSlot(const std::string& element_id) const;
+            PageDrawer&                         ResetSkipCounters();
+            PageDrawer&                         set_incremental_draw(bool incremental_draw);
+            std::vector<PageElementDrawer>      ExtractPageElements();
 
             /**
              * @brief Obtain page size
@@ -41,16 +74,70 @@ namespace improc
                 return this->page_size_;
             }
 
+            /**
+             * @brief Obtain number of page elements, i.e., the number of messages in the context. 
+             * Page elements of grid cells are only created when allocating, so they are counted before being created.
+             */
+            inline size_t                       get_number_elements() const
+            {
+                return this->number_elements_;
+            }
+
+            std::vector<std::vector<size_t>>    get_draw_levels()   const;
+
+            /**
+             * @brief Obtain render plan of allocated page, null if page drawer is not allocated
+             */
+            inline std::shared_ptr<const RenderPlan> get_render_plan() const
+            {
+                return this->render_plan_;
+            }
+
+            /**
+             * @brief Obtain slots of page elements with identifier
+             */
+            inline const std::unordered_map<std::string,size_t>& get_element_slots() const
+            {
+                return this->element_slots_;
+            }
+
+            /**
+             * @brief Obtain incremental draw mode
+             */
+            inline bool                         is_incremental_draw() const
+            {
+                return this->incremental_draw_;
+            }
+
+            /**
+             * @brief Obtain number of draws skipped per page element because its message did not change
+             */
+            inline const std::vector<size_t>&   get_skip_counters() const
+            {
+                return this->skip_counters_;
+            }
+
             /**
              * @brief Obtain page elements
              */
-            inline std::list<PageElementDrawer> get_page_elements() const
+            inline const std::vector<PageElementDrawer>& get_page_elements() const
             {
                 return this->elements_;
             }
 
+        protected:
+            PageDrawer&                         ClearPageElements();
+            PageDrawer&                         AppendPageElements(std::vector<PageElementDrawer>&& page_elements);
+            PageDrawer&                         AppendElementSlots(const std::unordered_map<std::string,size_t>& element_slots, size_t number_elements);
+            PageDrawer&                         CompileRenderPlan();
+            bool                                AllocateFromCache(const improc::RenderPlanCache& render_plan_cache);
+
         private:
-            PageDrawer&                         set_page_image(const cv::Mat& page_image);
+            bool                                HasRenderPlan (const std::list<std::optional<DrawerVariant>>& context) const;
+            static void                         AssignRenderCaches(const Json::Value& render_cache_json, std::vector<PageElementDrawer>& page_elements);
+            PageDrawer&                         DrawChangedElements(const std::list<std::optional<DrawerVariant>>& context);
+            PageDrawer&                         InvalidateSlotMessages();
+            void                                ValidatePageImage(const cv::Mat& page_image) const;
     };
 }
 
@@ -8,7 +8,8 @@
 
 #include <opencv2/core.hpp>
 #include <json/json.h>
-#include <list>
+#include <string>
+#include <vector>
 
 namespace improc 
 {
@@ -21,8 +22,10 @@ namespace improc
         private:
             cv::Point                       top_left_;
             cv::Rect                        element_box_;
+            unsigned int                    element_scale_;
             bool                            static_;
             std::optional<DrawerVariant>    content_;
+            std::string                     element_id_;
 
         public:
             PageElementDrawer();
@@ -30,15 +33,42 @@ namespace improc
 
             PageElementDrawer&              Load    (const improc::DrawerFactory& factory, const Json::Value& page_element_drawer_json, const cv::Size& page_size);
             PageElementDrawer&              Allocate();
+            PageElementDrawer&              Allocate(const cv::Rect& element_box, unsigned int element_scale);
             void                            Draw    (cv::Mat& page_image        , const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
             bool                            Verify  (const cv::Mat& page_image  , const std::optional<DrawerVariant>& message = std::optional<DrawerVariant>()) const;
 
             PageElementDrawer&              IncrementTopLeftBy(const cv::Point& increment_top_left, const cv::Size& page_size);
 
-            static std::list<PageElementDrawer> IncrementTopLeftBy  ( std::list<PageElementDrawer>&& page_elements
+            static std::vector<PageElementDrawer> IncrementTopLeftBy( std::vector<PageElementDrawer>&& page_elements
                                                                     , const cv::Point& increment_top_left
                                                                     , const cv::Size& page_size );
 
+            /**
+             * @brief Obtain page element top left position in page
+             */
+            inline cv::Point                get_top_left()      const
+            {
+                return this->top_left_;
+            }
+
+            /**
+             * @brief Obtain page element box in page, empty if page element is not allocated
+             */
+            inline cv::Rect                 get_element_box()   const
+            {
+                return this->element_box_;
+            }
+
+            /**
+             * @brief Obtain scale factor from element native size to element box size, obtained when allocating. 
+             * Dynamic page elements are allocated without message, so their scale factor is validated against the 
+             * message when verifying.
+             */
+            inline unsigned int             get_element_scale() const
+            {
+                return this->element_scale_;
+            }
+
             /**
              * @brief Obtain page element static property
              */
@@ -47,6 +77,52 @@ namespace improc
                 return this->static_;
             }
 
+            /**
+             * @brief Obtain page element content
+             */
+            inline const std::optional<DrawerVariant>& get_content() const
+            {
+                return this->content_;
+            }
+
+            /**
+             * @brief Obtain page element identifier, empty if page element has no identifier
+             */
+            inline const std::string&       get_element_id() const
+            {
+                return this->element_id_;
+            }
+
+            /**
+             * @brief Set page element identifier
+             * 
+             * @param element_id - page element identifier
+             */
+            inline PageElementDrawer&       set_element_id(const std::string& element_id)
+            {
+                this->element_id_ = element_id;
+                return (*this);
+            }
+
+            /**
+             * @brief Set render cache of page element
+             * 
+             * @param render_cache - render cache for element images, null to disable caching
+             */
+            inline PageElementDrawer&       set_render_cache(const std::shared_ptr<RenderCache>& render_cache)
+            {
+                this->improc::ElementDrawer::set_render_cache(render_cache);
+                return (*this);
+            }
+
+            /**
+             * @brief Obtain element drawer of page element
+             */
+            inline const ElementDrawer&     get_element_drawer() const
+            {
+                return (*this);
+            }
+
         private:
             static cv::Point                ParsePoint          (const Json::Value& point_json, const cv::Size& page_size);
             static void                     ValidatePoint       (const cv::Point&   point     , const cv::Size& page_size);
@@ -0,0 +1,88 @@
+#ifndef IMPROC_DRAWER_RENDER_CACHE_HPP
+#define IMPROC_DRAWER_RENDER_CACHE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/corecv/parsers/json_parser.hpp>
+#include <improc/drawer/logger_drawer.hpp>
+#include <improc/drawer/engine/base_drawer.hpp>
+
+#include <opencv2/core.hpp>
+#include <json/json.h>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace improc
+{
+    /**
+     * @brief Render cache methods and utilities.
+     * This class memoises element images by a content key, computed from the element configuration and the
+     * message hash. Each entry keeps the element configuration and the message, compared on every lookup, so 
+     * colliding content keys never return the element image of another element or message. 
+     * Least recently used element images are evicted when the cached bytes exceed the budget. Peek looks up an 
+     * element image without counting the lookup in the statistics nor changing the eviction order.
+     * Cached element images are never modified, so they can be copied from several threads while the cache
+     * is used concurrently.
+     */
+    class IMPROC_API RenderCache final
+    {
+        private:
+            /**
+             * @brief Cached element image with its key, element configuration and message
+             */
+            struct Entry
+            {
+                std::uint64_t                       key;
+                std::shared_ptr<const std::string>  element_config;
+                std::optional<DrawerVariant>        message;
+                cv::Mat                             element_image;
+                size_t                              bytes;
+            };
+
+            mutable std::mutex                                              mutex_;
+            size_t                                                          max_bytes_;
+            size_t                                                          bytes_;
+            std::list<Entry>                                                entries_;
+            std::unordered_map<std::uint64_t,std::list<Entry>::iterator>    entry_index_;
+            size_t                                                          hits_;
+            size_t                                                          misses_;
+
+        public:
+            explicit RenderCache(size_t max_bytes);
+            explicit RenderCache(const Json::Value& render_cache_json);
+
+            RenderCache(const RenderCache&  that) = delete;
+            RenderCache(RenderCache&&       that) = delete;
+            RenderCache& operator=(const RenderCache&  that) = delete;
+            RenderCache& operator=(RenderCache&&       that) = delete;
+
+            std::optional<cv::Mat>  Find    (std::uint64_t key, const std::string& element_config, const std::optional<DrawerVariant>& message);
+            std::optional<cv::Mat>  Peek    (std::uint64_t key, const std::string& element_config, const std::optional<DrawerVariant>& message) const;
+            void                    Insert  ( std::uint64_t key, const std::shared_ptr<const std::string>& element_config
+                                            , const std::optional<DrawerVariant>& message, const cv::Mat& element_image );
+            void                    Clear   ();
+
+            size_t                  get_number_entries()    const;
+            size_t                  get_bytes()             const;
+            size_t                  get_hits()              const;
+            size_t                  get_misses()            const;
+
+            /**
+             * @brief Obtain maximum number of cached bytes
+             */
+            inline size_t           get_max_bytes()         const
+            {
+                return this->max_bytes_;
+            }
+
+        private:
+            static bool             IsSameEntry(const Entry& entry, const std::string& element_config, const std::optional<DrawerVariant>& message);
+    };
+}
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef IMPROC_DRAWER_RENDER_PLAN_HPP
+#define IMPROC_DRAWER_RENDER_PLAN_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/drawer/engine/page_element_drawer.hpp>
+#include <improc/drawer/engine/worker_pool.hpp>
+#include <improc/drawer/engine/verification_report.hpp>
+
+#include <opencv2/core.hpp>
+#include <functional>
+#include <list>
+#include <optional>
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Render plan methods and utilities.
+     * This class is an immutable, flattened description of an allocated page. It contains the page background
+     * with the static page elements already drawn, the element box of every page element, a table of distinct
+     * element drawers referenced by index and the draw levels of the dynamic page elements. A render plan is
+     * only read when drawing and verifying, so it can be shared between threads.
+     * The scale factor of every page element is kept with its element box, so page elements are verified in 
+     * place without drawing them again.
+     * Contexts can be given as a list of messages or as a view of messages borrowed from the caller. Borrowed 
+     * messages are copied to message storage kept per thread and reused between page elements and pages, so 
+     * drawing from a context view does not allocate once the storage is large enough.
+     * A drawn page can also be updated slot by slot: only the changed page elements and the later page elements 
+     * overlapping them are drawn again, so the remaining regions of the page image are left untouched.
+     * Page elements can also be verified concurrently, reporting the result and the time of every page element.
+     */
+    class IMPROC_API RenderPlan final
+    {
+        private:
+            cv::Size                                    page_size_;
+            cv::Mat                                     background_;
+            std::vector<ElementDrawer>                  drawers_;
+            std::vector<cv::Rect>                       element_boxes_;
+            std::vector<unsigned int>                   element_scales_;
+            std::vector<size_t>                         drawer_indexes_;
+            std::vector<bool>                           static_elements_;
+            std::vector<std::optional<DrawerVariant>>   static_contents_;
+            std::vector<std::vector<size_t>>            draw_levels_;
+
+        public:
+            explicit RenderPlan(const cv::Size& page_size, const cv::Mat& background, const std::vector<PageElementDrawer>& page_elements);
+
+            RenderPlan(const RenderPlan&  that) = delete;
+            RenderPlan(RenderPlan&&       that) = delete;
+            RenderPlan& operator=(const RenderPlan&  that) = delete;
+            RenderPlan& operator=(RenderPlan&&       that) = delete;
+
+            void                                Draw        (cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context) const;
+            void                                DrawElements(cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context) const;
+            void                                DrawElements(cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context, improc::WorkerPool& worker_pool) const;
+            bool                                Verify      (const cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context) const;
+            void                                Draw        (cv::Mat& page_image, const DrawerContextView& context) const;
+            void                                DrawElements(cv::Mat& page_image, const DrawerContextView& context) const;
+            bool                                Verify      (const cv::Mat& page_image, const DrawerContextView& context) const;
+            VerificationReport                  Verify      (const cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context, improc::WorkerPool& worker_pool, VerificationPolicy policy = VerificationPolicy::kFullReport) const;
+            void                                DrawSlots   (cv::Mat& page_image, const std::vector<std::optional<DrawerVariant>>& messages, const std::vector<size_t>& slots) const;
+            bool                                VerifyElement(const cv::Mat& page_image, size_t elem_idx, const std::optional<DrawerVariant>& message) const;
+
+            /**
+             * @brief Obtain page size
+             */
+            inline cv::Size                     get_page_size()         const
+            {
+                return this->page_size_;
+            }
+
+            /**
+             * @brief Obtain page background with static page elements drawed
+             */
+            inline const cv::Mat&               get_background()        const
+            {
+                return this->background_;
+            }
+
+            /**
+             * @brief Obtain number of page elements
+             */
+            inline size_t                       get_number_elements()   const
+            {
+                return this->element_boxes_.size();
+            }
+
+            /**
+             * @brief Obtain number of distinct element drawers
+             */
+            inline size_t                       get_number_drawers()    const
+            {
+                return this->drawers_.size();
+            }
+
+            /**
+             * @brief Obtain page element boxes in page
+             */
+            inline const std::vector<cv::Rect>& get_element_boxes()     const
+            {
+                return this->element_boxes_;
+            }
+
+            /**
+             * @brief Obtain scale factors of page elements
+             */
+            inline const std::vector<unsigned int>& get_element_scales() const
+            {
+                return this->element_scales_;
+            }
+
+            /**
+             * @brief Obtain static property of page elements
+             */
+            inline const std::vector<bool>&     get_static_elements()   const
+            {
+                return this->static_elements_;
+            }
+
+            /**
+             * @brief Obtain contents of static page elements, empty for dynamic page elements
+             */
+            inline const std::vector<std::optional<DrawerVariant>>& get_static_contents() const
+            {
+                return this->static_contents_;
+            }
+
+            /**
+             * @brief Obtain element drawer of a page element
+             * 
+             * @param elem_idx - index of page element
+             */
+            inline const ElementDrawer&         get_element_drawer(size_t elem_idx) const
+            {
+                return this->drawers_[this->drawer_indexes_.at(elem_idx)];
+            }
+
+            /**
+             * @brief Obtain indexes of dynamic page elements grouped by draw level
+             */
+            inline const std::vector<std::vector<size_t>>& get_draw_levels() const
+            {
+                return this->draw_levels_;
+            }
+
+        private:
+            using MessageAccessor = std::function<const std::optional<DrawerVariant>&(size_t elem_idx)>;
+
+            void                                ValidateContext     (size_t context_size) const;
+            RenderPlan&                         ComputeDrawLevels   ();
+            void                                DrawMessages        (cv::Mat& page_image, const MessageAccessor& get_message) const;
+            bool                                VerifyMessages      (const cv::Mat& page_image, const MessageAccessor& get_message) const;
+
+            static MessageAccessor              GetListAccessor     (const std::list<std::optional<DrawerVariant>>& context);
+            static const std::optional<DrawerVariant>& BorrowMessage(const std::optional<DrawerVariantView>& message_view);
+    };
+}
+
+#endif
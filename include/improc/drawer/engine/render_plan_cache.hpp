@@ -0,0 +1,73 @@
+#ifndef IMPROC_DRAWER_RENDER_PLAN_CACHE_HPP
+#define IMPROC_DRAWER_RENDER_PLAN_CACHE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/infrastructure/context/application_context.hpp>
+#include <improc/drawer/engine/render_plan.hpp>
+
+#include <opencv2/core.hpp>
+#include <json/json.h>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Render plan cache methods and utilities.
+     * This class stores the allocation of a page in a versioned binary file: page size, element boxes, scale
+     * factors, static flags and the background with static page elements drawed. The file is tagged with a key computed from
+     * the page configuration and the files it references, such as fonts and images, so a cached allocation is
+     * only used while the configuration and those files are unchanged. Cache files are read with a memory map.
+     */
+    class IMPROC_API RenderPlanCache final
+    {
+        public:
+            static constexpr std::uint32_t kFormatVersion = 2;
+
+            /**
+             * @brief Page allocation read from a cache file
+             */
+            struct CachedAllocation
+            {
+                cv::Size                page_size;
+                cv::Mat                 background;
+                std::vector<cv::Rect>   element_boxes;
+                std::vector<unsigned int> element_scales;
+                std::vector<bool>       static_elements;
+            };
+
+        private:
+            std::string                 cache_filepath_;
+            std::uint64_t               key_;
+
+        public:
+            explicit RenderPlanCache(const std::string& cache_filepath, const Json::Value& page_drawer_json);
+            explicit RenderPlanCache(const std::string& cache_filepath, std::uint64_t key);
+
+            std::optional<CachedAllocation> Read () const;
+            void                            Write(const improc::RenderPlan& render_plan) const;
+
+            static std::uint64_t            ComputeKey(const Json::Value& page_drawer_json);
+
+            /**
+             * @brief Obtain cache file path
+             */
+            inline const std::string&   get_cache_filepath()    const
+            {
+                return this->cache_filepath_;
+            }
+
+            /**
+             * @brief Obtain cache key
+             */
+            inline std::uint64_t        get_key()               const
+            {
+                return this->key_;
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef IMPROC_DRAWER_VERIFICATION_REPORT_HPP
+#define IMPROC_DRAWER_VERIFICATION_REPORT_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/drawer/logger_drawer.hpp>
+
+#include <chrono>
+#include <string_view>
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Verification policy methods and utilities
+     */
+    class IMPROC_API VerificationPolicy final
+    {
+        public:
+            enum Value : IMPROC_ENUM_KEY_TYPE
+            {
+                    kFullReport = 0
+                ,   kFailFast   = 1
+            };
+
+        private:
+            Value                       value_;
+
+        public:
+            /**
+             * @brief Construct a new improc::VerificationPolicy object
+             *
+             * @param verification_policy_value - verification policy value
+             */
+            constexpr                   VerificationPolicy(Value verification_policy_value): value_(std::move(verification_policy_value)) {}
+
+            /**
+             * @brief Obtain verification policy value
+             */
+            constexpr operator          Value()     const {return this->value_;}
+
+            /**
+             * @brief Obtain verification policy string description
+             */
+            constexpr std::string_view  ToString()  const
+            {
+                switch (this->value_)
+                {
+                    case VerificationPolicy::Value::kFullReport : return "Full Report";   break;
+                    case VerificationPolicy::Value::kFailFast   : return "Fail Fast";     break;
+                }
+                return "";
+            }
+    };
+
+    /**
+     * @brief Verification report methods and utilities.
+     * This class contains the result and the verification time of every page element of a verified page.
+     * Page elements skipped after a failure in fail fast verification are reported as not verified.
+     */
+    class IMPROC_API VerificationReport final
+    {
+        public:
+            /**
+             * @brief Verification result of a page element
+             */
+            struct ElementResult
+            {
+                bool                        is_verified;
+                bool                        is_valid;
+                std::chrono::nanoseconds    duration;
+            };
+
+        private:
+            std::vector<ElementResult>  element_results_;
+            std::chrono::nanoseconds    duration_;
+
+        public:
+            VerificationReport();
+            explicit VerificationReport(std::vector<ElementResult>&& element_results, std::chrono::nanoseconds duration);
+
+            bool                        IsValid()               const;
+            size_t                      GetNumberVerified()     const;
+            std::vector<size_t>         GetInvalidElements()    const;
+
+            /**
+             * @brief Obtain verification results of page elements, in page order
+             */
+            inline const std::vector<ElementResult>& get_element_results() const
+            {
+                return this->element_results_;
+            }
+
+            /**
+             * @brief Obtain verification time of page
+             */
+            inline std::chrono::nanoseconds get_duration()      const
+            {
+                return this->duration_;
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef IMPROC_DRAWER_VERIFY_EFFORT_HPP
+#define IMPROC_DRAWER_VERIFY_EFFORT_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/drawer/logger_drawer.hpp>
+#include <improc/infrastructure/string.hpp>
+
+#include <string_view>
+
+namespace improc 
+{
+    /**
+     * @brief Verify effort methods and utilities.
+     * Pure verification decodes the symbol directly from the drawer output, as drawn at module resolution.
+     * Robust verification locates and binarizes the symbol before decoding it, as required for scanned images.
+     */
+    class IMPROC_API VerifyEffort final
+    {
+        public:
+            enum Value : IMPROC_ENUM_KEY_TYPE
+            {
+                    kPure   = 0
+                ,   kRobust = 1
+            };
+
+        private:
+            Value                       value_;
+
+        public:
+            VerifyEffort();                              
+            explicit VerifyEffort(const std::string& verify_effort_str);
+
+            /**
+             * @brief Construct a new improc::VerifyEffort object
+             * 
+             * @param verify_effort_value - verify effort value
+             */
+            constexpr explicit          VerifyEffort(Value verify_effort_value): value_(std::move(verify_effort_value)) {}
+
+            /**
+             * @brief Obtain verify effort value
+             */
+            constexpr operator          Value()     const {return this->value_;}
+
+            /**
+             * @brief Obtain verify effort string description
+             */
+            constexpr std::string_view  ToString()  const
+            {
+                switch (this->value_)
+                {
+                    case VerifyEffort::Value::kPure     : return "Pure";      break;
+                    case VerifyEffort::Value::kRobust   : return "Robust";    break;
+                }
+                return "";
+            }
+    };
+}
+
+#endif
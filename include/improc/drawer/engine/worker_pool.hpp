@@ -0,0 +1,60 @@
+#ifndef IMPROC_DRAWER_WORKER_POOL_HPP
+#define IMPROC_DRAWER_WORKER_POOL_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/drawer/logger_drawer.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace improc
+{
+    /**
+     * @brief Worker pool methods and utilities.
+     * This class distributes indexed tasks over a fixed set of threads. The calling thread also executes tasks,
+     * so nested calls to Run from within a task do not deadlock.
+     * A default worker pool with one worker per hardware thread is created on first use and shared by the 
+     * methods that are not given a worker pool.
+     */
+    class IMPROC_API WorkerPool final
+    {
+        private:
+            std::vector<std::thread>            workers_;
+            std::deque<std::function<void()>>   jobs_;
+            std::mutex                          jobs_mutex_;
+            std::condition_variable             jobs_condition_;
+            bool                                stopping_;
+
+        public:
+            WorkerPool();
+            explicit WorkerPool(unsigned int number_workers);
+            ~WorkerPool();
+
+            WorkerPool(const WorkerPool&  that) = delete;
+            WorkerPool(WorkerPool&&       that) = delete;
+            WorkerPool& operator=(const WorkerPool&  that) = delete;
+            WorkerPool& operator=(WorkerPool&&       that) = delete;
+
+            void                    Run(size_t number_tasks, const std::function<void(size_t)>& task);
+
+            static WorkerPool&      GetDefault();
+
+            /**
+             * @brief Obtain number of threads executing tasks, including the calling thread
+             */
+            inline unsigned int     get_number_workers() const
+            {
+                return static_cast<unsigned int>(this->workers_.size()) + 1;
+            }
+
+        private:
+            void                    Work();
+    };
+}
+
+#endif
\ No newline at end of file
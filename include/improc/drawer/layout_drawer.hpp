@@ -19,15 +19,37 @@ namespace improc
      */
     class IMPROC_API LayoutDrawer final: protected improc::PageDrawer
     {
+        private:
+            std::vector<std::shared_ptr<PageDrawer>>    page_drawers_;
+            std::vector<PageDrawerType>                 page_drawer_types_;
+            std::vector<cv::Point>                      page_drawer_top_lefts_;
+            std::vector<std::string>                    page_drawer_ids_;
+
         public:
             LayoutDrawer();
             explicit LayoutDrawer(const improc::DrawerFactory& factory, const Json::Value& grid_drawer_json);
 
             LayoutDrawer&       Load    (const improc::DrawerFactory& factory, const Json::Value& layout_drawer_json);
             LayoutDrawer&       Allocate();
+            LayoutDrawer&       Allocate(const improc::RenderPlanCache& render_plan_cache);
             cv::Mat             Draw    (const std::list<std::optional<DrawerVariant>>& context = std::list<std::optional<DrawerVariant>>());
+            cv::Mat             Draw    (const std::list<std::optional<DrawerVariant>>& context, improc::WorkerPool& worker_pool);
+            void                Draw    (cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context) const;
+            improc::PooledPage  Draw    (improc::PageBufferPool& page_buffer_pool, const std::list<std::optional<DrawerVariant>>& context) const;
+            std::vector<cv::Mat> DrawBatch(const std::vector<std::list<std::optional<DrawerVariant>>>& contexts) const;
+            std::vector<cv::Mat> DrawBatch(const std::vector<std::list<std::optional<DrawerVariant>>>& contexts, improc::WorkerPool& worker_pool) const;
             bool                Verify  (const std::list<std::optional<DrawerVariant>>& context = std::list<std::optional<DrawerVariant>>());
-            bool                Verify  (const cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context = std::list<std::optional<DrawerVariant>>());
+            bool                Verify  (const cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context = std::list<std::optional<DrawerVariant>>()) const;
+            void                Draw    (cv::Mat& page_image, const DrawerContextView& context) const;
+            improc::PooledPage  Draw    (improc::PageBufferPool& page_buffer_pool, const DrawerContextView& context) const;
+            bool                Verify  (const cv::Mat& page_image, const DrawerContextView& context) const;
+            VerificationReport  Verify  (const std::list<std::optional<DrawerVariant>>& context, improc::WorkerPool& worker_pool, VerificationPolicy policy = VerificationPolicy::kFullReport) const;
+            VerificationReport  Verify  (const cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context, improc::WorkerPool& worker_pool, VerificationPolicy policy = VerificationPolicy::kFullReport) const;
+            cv::Mat             DrawSlots(const std::vector<std::pair<size_t,std::optional<DrawerVariant>>>& slot_context);
+            cv::Mat             DrawSlots(const std::unordered_map<std::string,std::optional<DrawerVariant>>& element_context);
+            size_t              GetElementSlot(const std::string& element_id) const;
+            LayoutDrawer&       ResetSkipCounters();
+            LayoutDrawer&       set_incremental_draw(bool incremental_draw);
 
             /**
              * @brief Obtain page size
@@ -37,9 +59,43 @@ namespace improc
                 return this->improc::PageDrawer::get_page_size();
             }
 
+            /**
+             * @brief Obtain render plan of allocated layout, null if layout drawer is not allocated
+             */
+            inline std::shared_ptr<const RenderPlan> get_render_plan() const
+            {
+                return this->improc::PageDrawer::get_render_plan();
+            }
+
+            /**
+             * @brief Obtain slots of layout elements with identifier
+             */
+            inline const std::unordered_map<std::string,size_t>& get_element_slots() const
+            {
+                return this->improc::PageDrawer::get_element_slots();
+            }
+
+            /**
+             * @brief Obtain incremental draw mode
+             */
+            inline bool         is_incremental_draw() const
+            {
+                return this->improc::PageDrawer::is_incremental_draw();
+            }
+
+            /**
+             * @brief Obtain number of draws skipped per layout element because its message did not change
+             */
+            inline const std::vector<size_t>& get_skip_counters() const
+            {
+                return this->improc::PageDrawer::get_skip_counters();
+            }
+
         private:
             LayoutDrawer&       ParsePageTypeDrawer (const improc::DrawerFactory& factory, const Json::Value& page_drawer_type_json);
             LayoutDrawer&       CorrectLayoutSize   (const cv::Point& top_left, const cv::Size& page_drawer_size);
+            LayoutDrawer&       ComposeLayout       (bool draw_static_elements);
+            static std::string  GetLayoutElementId  (const std::string& page_drawer_id, const std::string& element_id);
             static cv::Point    ParsePoint          (const Json::Value& point_json);
             static inline bool  IsPixelPositionValid(int pixel_position);
     };
@@ -0,0 +1,75 @@
+#ifndef IMPROC_DRAWER_PAGE_REGISTRATION_HPP
+#define IMPROC_DRAWER_PAGE_REGISTRATION_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/drawer/logger_drawer.hpp>
+#include <improc/drawer/engine/render_plan.hpp>
+#include <improc/drawer/engine/verification_report.hpp>
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace improc 
+{
+    /**
+     * @brief Page registration methods and utilities.
+     * This class verifies scanned or captured page images that are not aligned with the page layout. The static 
+     * fiducial page elements of the page are located in the scan, each one inside a search window around its 
+     * expected location, and a homography from page to scan is estimated from their centers. The search window 
+     * of every page element, i.e., its element box extended by the search margin, is then rectified into page 
+     * coordinates and the page element is located in it by template matching, so that homography errors up to 
+     * the search margin are corrected. The located page element is sampled with one pixel per module at the 
+     * native size of the element drawer, binarized and verified.
+     */
+    class IMPROC_API PageRegistration final
+    {
+        public:
+            static constexpr size_t             kMinFiducials = 4;
+
+        private:
+            std::shared_ptr<const RenderPlan>   render_plan_;
+            std::vector<size_t>                 fiducial_elements_;
+            unsigned int                        search_margin_;
+
+        public:
+            explicit PageRegistration(const std::shared_ptr<const RenderPlan>& render_plan, const std::string& fiducial_drawer_type, unsigned int search_margin);
+
+            cv::Matx33d                         EstimateHomography(const cv::Mat& scan_image) const;
+            VerificationReport                  Verify(const cv::Mat& scan_image, const std::list<std::optional<DrawerVariant>>& context) const;
+
+            /**
+             * @brief Obtain indexes of fiducial page elements
+             */
+            inline const std::vector<size_t>&   get_fiducial_elements() const
+            {
+                return this->fiducial_elements_;
+            }
+
+            /**
+             * @brief Obtain margin of search windows in pixels, of the scan for fiducial page elements and of the page 
+             * for the remaining page elements
+             */
+            inline unsigned int                 get_search_margin() const
+            {
+                return this->search_margin_;
+            }
+
+        private:
+            cv::Rect                            GetSearchWindow(const cv::Rect& region, const cv::Mat& scan_image) const;
+            bool                                VerifyElement(const cv::Mat& scan_image, const cv::Matx33d& homography, size_t elem_idx, const std::optional<DrawerVariant>& message) const;
+
+            static cv::Matx33d                  GetNormalization(const std::vector<cv::Point2d>& points);
+    };
+}
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef IMPROC_DRAWER_PAGE_SYMBOL_VERIFIER_HPP
+#define IMPROC_DRAWER_PAGE_SYMBOL_VERIFIER_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/drawer/logger_drawer.hpp>
+#include <improc/drawer/engine/render_plan.hpp>
+#include <improc/drawer/engine/verification_report.hpp>
+
+#include <ImageView.h>
+#include <ReadBarcode.h>
+#include <ReaderOptions.h>
+#include <Result.h>
+#include <opencv2/core.hpp>
+#include <algorithm>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace improc 
+{
+    /**
+     * @brief Page symbol verifier methods and utilities.
+     * This class verifies the symbol page elements of a page image, i.e., the page elements drawn by the drawer 
+     * types given with their symbol format, with a single detection and decoding pass over the whole page. 
+     * The page image is binarized once and every decoded symbol with the format of a page element is assigned 
+     * to the page element whose element box contains its center.
+     * The decoding pass locates symbols, as robust verification does, so it only covers symbol page elements 
+     * with robust verify effort and a quiet zone, i.e., a margin around the element box that is inside the page 
+     * and does not overlap other page elements. The quiet zone has 4 modules for qr-codes, 1 module for data 
+     * matrices and 10 modules for barcodes, since drawers do not add margins to their symbols. The decoding pass 
+     * is skipped when no page element has a quiet zone. Symbol page elements outside the decoding pass, symbol 
+     * page elements without a decoded symbol and the remaining page elements are verified one by one with the 
+     * render plan.
+     */
+    class IMPROC_API PageSymbolVerifier final
+    {
+        private:
+            std::shared_ptr<const RenderPlan>   render_plan_;
+            std::vector<bool>                   symbol_elements_;
+            std::vector<ZXing::BarcodeFormat>   symbol_formats_;
+            std::vector<bool>                   page_pass_elements_;
+            ZXing::ReaderOptions                reader_options_;
+
+        public:
+            explicit PageSymbolVerifier(const std::shared_ptr<const RenderPlan>& render_plan, const std::unordered_map<std::string,ZXing::BarcodeFormat>& symbol_drawer_types);
+
+            VerificationReport                  Verify(const cv::Mat& page_image, const std::list<std::optional<DrawerVariant>>& context) const;
+
+            /**
+             * @brief Obtain symbol property of page elements
+             */
+            inline const std::vector<bool>&     get_symbol_elements() const
+            {
+                return this->symbol_elements_;
+            }
+
+            /**
+             * @brief Obtain page elements covered by the decoding pass over the whole page
+             */
+            inline const std::vector<bool>&     get_page_pass_elements() const
+            {
+                return this->page_pass_elements_;
+            }
+
+        private:
+            bool                                HasQuietZone(size_t elem_idx) const;
+            std::optional<size_t>               FindSymbolElement(const ZXing::Result& symbol) const;
+
+            static int                          GetQuietZoneModules(ZXing::BarcodeFormat symbol_format);
+    };
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef IMPROC_DRAWER_RENDER_PIPELINE_HPP
+#define IMPROC_DRAWER_RENDER_PIPELINE_HPP
+
+#include <improc/improc_defs.hpp>
+#include <improc/exception.hpp>
+#include <improc/drawer/engine/page_drawer.hpp>
+#include <improc/drawer/engine/render_plan.hpp>
+#include <improc/drawer/engine/bounded_queue.hpp>
+#include <improc/drawer/layout_drawer.hpp>
+
+#include <opencv2/core.hpp>
+#include <functional>
+#include <list>
+#include <optional>
+
+namespace improc
+{
+    /**
+     * @brief Render pipeline methods and utilities.
+     * This class streams page contexts from a producer to a set of workers that draw the pages and delivers
+     * the page images, in the same order as the contexts, to a sink. At most capacity pages are in flight
+     * between the producer and the sink, so the producer waits for the sink whenever it gets ahead and memory
+     * does not grow with the number of pages. The page drawer must outlive the render pipeline, while a render 
+     * plan is kept alive by the render pipeline itself.
+     */
+    class IMPROC_API RenderPipeline final
+    {
+        public:
+            using PageContext   = std::list<std::optional<DrawerVariant>>;
+            using Producer      = std::function<std::optional<PageContext>()>;
+            using Sink          = std::function<void(size_t page_idx, const cv::Mat& page_image)>;
+
+        private:
+            std::function<void(cv::Mat&,const PageContext&)>    draw_page_;
+            unsigned int                                        number_workers_;
+            size_t                                              capacity_;
+
+        public:
+            explicit RenderPipeline(const improc::PageDrawer&   page_drawer  , unsigned int number_workers, size_t capacity);
+            explicit RenderPipeline(const improc::LayoutDrawer& layout_drawer, unsigned int number_workers, size_t capacity);
+            explicit RenderPipeline(const std::shared_ptr<const improc::RenderPlan>& render_plan, unsigned int number_workers, size_t capacity);
+
+            size_t                  Run(const Producer& producer, const Sink& sink) const;
+
+            /**
+             * @brief Obtain number of threads drawing pages
+             */
+            inline unsigned int     get_number_workers() const
+            {
+                return this->number_workers_;
+            }
+
+            /**
+             * @brief Obtain maximum number of pages in flight between producer and sink
+             */
+            inline size_t           get_capacity()       const
+            {
+                return this->capacity_;
+            }
+
+        private:
+            explicit RenderPipeline(std::function<void(cv::Mat&,const PageContext&)>&& draw_page, unsigned int number_workers, size_t capacity);
+    };
+}
+
+#endif
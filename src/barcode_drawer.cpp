@@ -5,15 +5,7 @@
  */
 improc::BarcodeDrawer::BarcodeDrawer()  : improc::BaseDrawer() 
                                         , writer_(ZXing::OneD::Code128Writer())
-                                        , reader_options_(ZXing::ReaderOptions())
-{
-    IMPROC_DRAWER_LOGGER_TRACE("Creating default barcode drawer...");
-    this->reader_options_.setTryHarder(improc::BarcodeDrawer::kTryHarder);
-    this->reader_options_.setTryRotate(improc::BarcodeDrawer::kDoNotRotate);
-    this->reader_options_.setIsPure(improc::BarcodeDrawer::kNotPure);
-    this->reader_options_.setMinLineCount(improc::BarcodeDrawer::kMinHeight);
-    this->reader_options_.setFormats(improc::BarcodeDrawer::kBarcodeFormat);
-}
+                                        , verify_effort_(improc::VerifyEffort()) {};
 
 /**
  * @brief Construct a new improc::BarcodeDrawer object
@@ -33,7 +25,13 @@ improc::BarcodeDrawer::BarcodeDrawer(const Json::Value& drawer_json) : improc::B
 improc::BarcodeDrawer& improc::BarcodeDrawer::Load(const Json::Value& drawer_json)
 {
     IMPROC_DRAWER_LOGGER_TRACE("Creating barcode drawer...");
+    static const std::string kVerifyEffortKey = "verify-effort";
     this->writer_.setMargin(improc::BarcodeDrawer::kMargin);
+    this->verify_effort_ = improc::VerifyEffort();
+    if (drawer_json.isMember(kVerifyEffortKey) == true)
+    {
+        this->verify_effort_ = improc::VerifyEffort(improc::json::ReadElement<std::string>(drawer_json[kVerifyEffortKey]));
+    }
     return (*this);
 };
 
@@ -43,31 +41,87 @@ improc::BarcodeDrawer& improc::BarcodeDrawer::Load(const Json::Value& drawer_jso
  * @param message - message to be encoded in barcode
  * @return cv::Mat - barcode image with encoded message
  */
-cv::Mat improc::BarcodeDrawer::Draw(const std::optional<improc::DrawerVariant>& message)
+cv::Mat improc::BarcodeDrawer::Draw(const std::optional<improc::DrawerVariant>& message) const
 {
     IMPROC_DRAWER_LOGGER_TRACE("Drawing barcode...");
     ZXing::BitMatrix barcode_data = this->writer_.encode( std::get<std::string>(message.value())
                                                         , improc::BarcodeDrawer::kMinWidth
                                                         , improc::BarcodeDrawer::kMinHeight );
     cv::Mat barcode ( barcode_data.height(),barcode_data.width(),improc::BaseDrawer::kImageDataType );
-    std::transform  ( barcode_data.row(0).begin()
-                    , barcode_data.row(barcode_data.height()).end()
-                    , barcode.begin<uint8_t>()
-                    , [] (const uint8_t& bitmatrix_item) 
-                        {
-                            if (bitmatrix_item != 0)
-                            {
-                                return improc::BaseDrawer::kBlackValue;
-                            }
-                            else
-                            {
-                                return improc::BaseDrawer::kWhiteValue;
-                            }
-                        }
-                    );
+    improc::BarcodeDrawer::RasterizeBitMatrix(barcode_data,barcode);
     return barcode;
 };
 
+/**
+ * @brief Draw barcode directly in a region of interest
+ * 
+ * @param roi - region of interest with the size of the barcode image
+ * @param message - message to be encoded in barcode
+ */
+void improc::BarcodeDrawer::DrawInto(cv::Mat& roi, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing barcode into region of interest...");
+    ZXing::BitMatrix barcode_data = this->writer_.encode( std::get<std::string>(message.value())
+                                                        , improc::BarcodeDrawer::kMinWidth
+                                                        , improc::BarcodeDrawer::kMinHeight );
+    improc::BaseDrawer::ValidateRoi(roi,cv::Size(barcode_data.width(),barcode_data.height()));
+    improc::BarcodeDrawer::RasterizeBitMatrix(barcode_data,roi);
+}
+
+/**
+ * @brief Obtain size of barcode image from the encoded symbol, without rasterizing it
+ * 
+ * @param message - message to be encoded in barcode
+ * @return cv::Size - size of barcode image
+ */
+cv::Size improc::BarcodeDrawer::GetOutputSize(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining barcode size...");
+    ZXing::BitMatrix barcode_data = this->writer_.encode( std::get<std::string>(message.value())
+                                                        , improc::BarcodeDrawer::kMinWidth
+                                                        , improc::BarcodeDrawer::kMinHeight );
+    return cv::Size(barcode_data.width(),barcode_data.height());
+}
+
+/**
+ * @brief Obtain verify effort of barcode drawer
+ * 
+ * @return std::optional<VerifyEffort> - verify effort
+ */
+std::optional<improc::VerifyEffort> improc::BarcodeDrawer::GetVerifyEffort() const
+{
+    return this->verify_effort_;
+}
+
+/**
+ * @brief Write barcode bars in image, row by row since the image may be a region of a larger image
+ * 
+ * @param matrix_data - encoded barcode
+ * @param roi - image with the size of the barcode
+ */
+void improc::BarcodeDrawer::RasterizeBitMatrix(const ZXing::BitMatrix& matrix_data, cv::Mat& roi)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Rasterizing barcode...");
+    for (int pixel_y = 0; pixel_y < matrix_data.height(); pixel_y++)
+    {
+        std::transform  ( matrix_data.row(pixel_y).begin()
+                        , matrix_data.row(pixel_y).end()
+                        , roi.ptr<uint8_t>(pixel_y)
+                        , [] (const uint8_t& bitmatrix_item) 
+                            {
+                                if (bitmatrix_item != 0)
+                                {
+                                    return improc::BaseDrawer::kBlackValue;
+                                }
+                                else
+                                {
+                                    return improc::BaseDrawer::kWhiteValue;
+                                }
+                            }
+                        );
+    }
+}
+
 /**
  * @brief Verify message encoded in barcode
  * 
@@ -75,23 +129,44 @@ cv::Mat improc::BarcodeDrawer::Draw(const std::optional<improc::DrawerVariant>&
  * @param message - message encoded in barcode
  * @return bool - true if message and message recovered from the barcode image is the same, false otherwise.
  */
-bool improc::BarcodeDrawer::Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message)
+bool improc::BarcodeDrawer::Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message) const
 {
-    IMPROC_DRAWER_LOGGER_TRACE("Verifying barcode content...");
-    ZXing::OneD::Reader reader {this->reader_options_};
-    std::unique_ptr<ZXing::BinaryBitmap> barcode_bitmap = 
-        std::make_unique<ZXing::ThresholdBinarizer> ( ZXing::ImageView  ( drawer_output.data
-                                                                        , drawer_output.cols
-                                                                        , drawer_output.rows
-                                                                        , improc::BarcodeDrawer::kImageFormat
-                                                    ), 0 );
-    ZXing::Result result = reader.decode(*barcode_bitmap);
-    if (result.isValid() == true)
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying barcode content with {} effort...",this->verify_effort_.ToString());
+    ZXing::ImageView barcode_view   ( drawer_output.data
+                                    , drawer_output.cols
+                                    , drawer_output.rows
+                                    , improc::BarcodeDrawer::kImageFormat
+                                    , static_cast<int>(drawer_output.step) );
+    // Binarizers are bound to the image they wrap and binarize it lazily, so only the readers are kept per thread.
+    ZXing::Result result {};
+    if (this->verify_effort_ == improc::VerifyEffort::kPure)
     {
-        return result.text() == std::get<std::string>(message.value());
+        result = improc::BarcodeDrawer::GetReader(this->verify_effort_).decode(ZXing::ThresholdBinarizer(barcode_view,improc::BarcodeDrawer::kBlackThreshold));
     }
     else
     {
-        return false;
+        result = improc::BarcodeDrawer::GetReader(this->verify_effort_).decode(ZXing::GlobalHistogramBinarizer(barcode_view));
     }
-}
\ No newline at end of file
+    return result.isValid() == true && result.text() == std::get<std::string>(message.value());
+}
+
+/**
+ * @brief Obtain barcode reader kept per thread for a verify effort
+ * 
+ * @param verify_effort - verify effort
+ * @return const ZXing::OneD::Reader& - barcode reader of the calling thread
+ */
+const ZXing::OneD::Reader& improc::BarcodeDrawer::GetReader(improc::VerifyEffort verify_effort)
+{
+    static const ZXing::ReaderOptions kPureOptions   = ZXing::ReaderOptions().setFormats(improc::BarcodeDrawer::kBarcodeFormat)
+                                                                             .setTryRotate(improc::BarcodeDrawer::kDoNotRotate)
+                                                                             .setIsPure(true)
+                                                                             .setMinLineCount(improc::BarcodeDrawer::kPureMinHeight);
+    static const ZXing::ReaderOptions kRobustOptions = ZXing::ReaderOptions().setFormats(improc::BarcodeDrawer::kBarcodeFormat)
+                                                                             .setTryRotate(improc::BarcodeDrawer::kDoNotRotate)
+                                                                             .setTryHarder(true)
+                                                                             .setMinLineCount(improc::BarcodeDrawer::kMinHeight);
+    thread_local const ZXing::OneD::Reader pure_reader   {kPureOptions};
+    thread_local const ZXing::OneD::Reader robust_reader {kRobustOptions};
+    return verify_effort == improc::VerifyEffort::kPure ? pure_reader : robust_reader;
+}
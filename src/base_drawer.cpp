@@ -1,5 +1,10 @@
 #include <improc/drawer/engine/base_drawer.hpp>
 
+namespace
+{
+    constexpr std::uint64_t kFnvPrime = 0x00000100000001b3ULL;
+}
+
 /**
  * @brief Construct a new improc::BaseDrawer object
  */
@@ -12,6 +17,63 @@ improc::BaseDrawer::BaseDrawer() {};
  */
 improc::BaseDrawer::BaseDrawer(const Json::Value& drawer_json) : improc::BaseDrawer() {};
 
+/**
+ * @brief Draw in a region of interest of a larger image. 
+ * This default implementation draws in a new image and copies it to the region of interest.
+ * 
+ * @param roi - region of interest with the size of the drawer output
+ * @param message - message to be drawed
+ */
+void improc::BaseDrawer::DrawInto(cv::Mat& roi, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing into region of interest...");
+    cv::Mat drawer_output = this->Draw(std::move(message));
+    improc::BaseDrawer::ValidateRoi(roi,drawer_output.size());
+    drawer_output.copyTo(roi);
+}
+
+/**
+ * @brief Obtain size of drawer output. 
+ * This default implementation draws the message and returns the size of the output.
+ * 
+ * @param message - message to be drawed
+ * @return cv::Size - size of drawer output
+ */
+cv::Size improc::BaseDrawer::GetOutputSize(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining drawer output size...");
+    return this->Draw(std::move(message)).size();
+}
+
+/**
+ * @brief Obtain verify effort of drawer. 
+ * This default implementation is empty, since the drawer does not decode symbols.
+ * 
+ * @return std::optional<VerifyEffort> - verify effort of symbol drawers, empty otherwise
+ */
+std::optional<improc::VerifyEffort> improc::BaseDrawer::GetVerifyEffort() const
+{
+    return std::nullopt;
+}
+
+/**
+ * @brief Validate that the region of interest can receive the drawer output without being reallocated
+ * 
+ * @param roi - region of interest
+ * @param output_size - size of drawer output
+ */
+void improc::BaseDrawer::ValidateRoi(const cv::Mat& roi, const cv::Size& output_size)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Validating region of interest...");
+    if (roi.size() != output_size || roi.type() != improc::BaseDrawer::kImageDataType)
+    {
+        std::string error_message = fmt::format ( "Region of interest (w={},h={}) should have the size of the drawer output (w={},h={}) and the drawer data type"
+                                                , roi.cols, roi.rows, output_size.width, output_size.height );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+}
+
 /**
  * @brief Construct a new improc::BaseDrawer object
  * 
@@ -38,4 +100,47 @@ std::shared_ptr<improc::BaseDrawer> improc::BaseDrawer::Create(const improc::Dra
         drawer_args = drawer_json[kDrawerArgs];
     }
     return std::move(factory).Create(std::move(drawer_type),std::move(drawer_args));
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Obtain a FNV-1a hash of a message. 
+ * The hash covers the message type and payload, so messages with the same bytes but different types differ.
+ * 
+ * @param message - message to be drawed
+ * @return std::uint64_t - hash of message
+ */
+std::uint64_t improc::BaseDrawer::HashMessage(const std::optional<improc::DrawerVariant>& message)
+{
+    std::uint64_t hash = improc::BaseDrawer::kHashOffsetBasis;
+    if (message.has_value() == false)
+    {
+        return hash;
+    }
+
+    const std::uint64_t payload_type = message.value().index() + 1;
+    hash = improc::BaseDrawer::HashBytes(hash,&payload_type,sizeof(payload_type));
+    return std::visit   ( [hash] (const auto& payload) -> std::uint64_t
+                            {
+                                return improc::BaseDrawer::HashBytes(hash,payload.data(),payload.size() * sizeof(payload[0]));
+                            }
+                        , message.value() );
+}
+
+/**
+ * @brief Add a sequence of bytes to a FNV-1a hash
+ * 
+ * @param hash - hash to be updated, kHashOffsetBasis for a new hash
+ * @param data - bytes to be added
+ * @param number_bytes - number of bytes to be added
+ * @return std::uint64_t - updated hash
+ */
+std::uint64_t improc::BaseDrawer::HashBytes(std::uint64_t hash, const void* data, size_t number_bytes)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t byte_idx = 0; byte_idx < number_bytes; byte_idx++)
+    {
+        hash ^= bytes[byte_idx];
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
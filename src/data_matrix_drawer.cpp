@@ -4,7 +4,8 @@
  * @brief Construct a new improc::DataMatrixDrawer object
  */
 improc::DataMatrixDrawer::DataMatrixDrawer(): improc::BaseDrawer() 
-                                            , writer_(ZXing::DataMatrix::Writer()) {}
+                                            , writer_(ZXing::DataMatrix::Writer())
+                                            , verify_effort_(improc::VerifyEffort()) {}
 
 /**
  * @brief Construct a new improc::DataMatrixDrawer object
@@ -24,8 +25,14 @@ improc::DataMatrixDrawer::DataMatrixDrawer(const Json::Value& drawer_json) : imp
 improc::DataMatrixDrawer& improc::DataMatrixDrawer::Load(const Json::Value& drawer_json)
 {
     IMPROC_DRAWER_LOGGER_TRACE("Creating data matrix drawer...");
+    static const std::string kVerifyEffortKey = "verify-effort";
     this->writer_.setMargin(improc::DataMatrixDrawer::kMargin);
     this->writer_.setShapeHint(improc::DataMatrixDrawer::kSquareSymbolShape);
+    this->verify_effort_ = improc::VerifyEffort();
+    if (drawer_json.isMember(kVerifyEffortKey) == true)
+    {
+        this->verify_effort_ = improc::VerifyEffort(improc::json::ReadElement<std::string>(drawer_json[kVerifyEffortKey]));
+    }
     return (*this);
 };
 
@@ -35,7 +42,7 @@ improc::DataMatrixDrawer& improc::DataMatrixDrawer::Load(const Json::Value& draw
  * @param message - message to be encoded in data matrix
  * @return cv::Mat - data matrix image with encoded message
  */
-cv::Mat improc::DataMatrixDrawer::Draw(const std::optional<improc::DrawerVariant>& message)
+cv::Mat improc::DataMatrixDrawer::Draw(const std::optional<improc::DrawerVariant>& message) const
 {
     IMPROC_DRAWER_LOGGER_TRACE("Drawing data matrix...");
     std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter {};
@@ -43,24 +50,82 @@ cv::Mat improc::DataMatrixDrawer::Draw(const std::optional<improc::DrawerVariant
                                                         , improc::DataMatrixDrawer::kMinWidth
                                                         , improc::DataMatrixDrawer::kMinHeight );
     cv::Mat data_matrix (matrix_data.height(),matrix_data.width(),improc::BaseDrawer::kImageDataType);
-    std::transform  ( matrix_data.row(0).begin()
-                    , matrix_data.row(matrix_data.height()).end()
-                    , data_matrix.begin<uint8_t>()
-                    , [] (const uint8_t& bitmatrix_item) 
-                        {
-                            if (bitmatrix_item != 0)
-                            {
-                                return improc::BaseDrawer::kBlackValue;
-                            }
-                            else
-                            {
-                                return improc::BaseDrawer::kWhiteValue;
-                            }
-                        }
-                    );
+    improc::DataMatrixDrawer::RasterizeBitMatrix(matrix_data,data_matrix);
     return data_matrix;
 };
 
+/**
+ * @brief Draw data matrix directly in a region of interest
+ * 
+ * @param roi - region of interest with the size of the data matrix image
+ * @param message - message to be encoded in data matrix
+ */
+void improc::DataMatrixDrawer::DrawInto(cv::Mat& roi, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing data matrix into region of interest...");
+    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter {};
+    ZXing::BitMatrix matrix_data = this->writer_.encode ( converter.from_bytes(std::get<std::string>(message.value()))
+                                                        , improc::DataMatrixDrawer::kMinWidth
+                                                        , improc::DataMatrixDrawer::kMinHeight );
+    improc::BaseDrawer::ValidateRoi(roi,cv::Size(matrix_data.width(),matrix_data.height()));
+    improc::DataMatrixDrawer::RasterizeBitMatrix(matrix_data,roi);
+}
+
+/**
+ * @brief Obtain size of data matrix image from the encoded symbol, without rasterizing it
+ * 
+ * @param message - message to be encoded in data matrix
+ * @return cv::Size - size of data matrix image
+ */
+cv::Size improc::DataMatrixDrawer::GetOutputSize(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining data matrix size...");
+    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter {};
+    ZXing::BitMatrix matrix_data = this->writer_.encode ( converter.from_bytes(std::get<std::string>(message.value()))
+                                                        , improc::DataMatrixDrawer::kMinWidth
+                                                        , improc::DataMatrixDrawer::kMinHeight );
+    return cv::Size(matrix_data.width(),matrix_data.height());
+}
+
+/**
+ * @brief Obtain verify effort of data matrix drawer
+ * 
+ * @return std::optional<VerifyEffort> - verify effort
+ */
+std::optional<improc::VerifyEffort> improc::DataMatrixDrawer::GetVerifyEffort() const
+{
+    return this->verify_effort_;
+}
+
+/**
+ * @brief Write data matrix modules in image, row by row since the image may be a region of a larger image
+ * 
+ * @param matrix_data - encoded data matrix
+ * @param roi - image with the size of the data matrix
+ */
+void improc::DataMatrixDrawer::RasterizeBitMatrix(const ZXing::BitMatrix& matrix_data, cv::Mat& roi)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Rasterizing data matrix...");
+    for (int pixel_y = 0; pixel_y < matrix_data.height(); pixel_y++)
+    {
+        std::transform  ( matrix_data.row(pixel_y).begin()
+                        , matrix_data.row(pixel_y).end()
+                        , roi.ptr<uint8_t>(pixel_y)
+                        , [] (const uint8_t& bitmatrix_item) 
+                            {
+                                if (bitmatrix_item != 0)
+                                {
+                                    return improc::BaseDrawer::kBlackValue;
+                                }
+                                else
+                                {
+                                    return improc::BaseDrawer::kWhiteValue;
+                                }
+                            }
+                        );
+    }
+}
+
 /**
  * @brief Verify message encoded in data matrix
  * 
@@ -68,23 +133,50 @@ cv::Mat improc::DataMatrixDrawer::Draw(const std::optional<improc::DrawerVariant
  * @param message - message encoded in data matrix
  * @return bool - true if message and message recovered from the data matrix image is the same, false otherwise.
  */
-bool improc::DataMatrixDrawer::Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message)
+bool improc::DataMatrixDrawer::Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message) const
 {
-    IMPROC_DRAWER_LOGGER_TRACE("Verifying data matrix content...");
-    std::unique_ptr<ZXing::BinaryBitmap> data_matrix_bitmap = 
-        std::make_unique<ZXing::ThresholdBinarizer> ( ZXing::ImageView  ( drawer_output.data
-                                                                        , drawer_output.cols
-                                                                        , drawer_output.rows
-                                                                        , improc::DataMatrixDrawer::kImageFormat
-                                                    ), 0 );
-    ZXing::DecoderResult result = ZXing::DataMatrix::Decode(*(data_matrix_bitmap->getBitMatrix()));
-    if (result.isValid() == true)
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying data matrix content with {} effort...",this->verify_effort_.ToString());
+    if (this->verify_effort_ == improc::VerifyEffort::kPure)
     {
+        ZXing::DecoderResult result = ZXing::DataMatrix::Decode(improc::DataMatrixDrawer::BinarizeImage(drawer_output));
+        if (result.isValid() == false)
+        {
+            return false;
+        }
         std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter {};
         return converter.to_bytes(result.text()) == std::get<std::string>(message.value());
     }
-    else
+
+    static const ZXing::ReaderOptions kRobustOptions = ZXing::ReaderOptions().setFormats(ZXing::BarcodeFormat::DataMatrix).setTryHarder(true);
+    thread_local const ZXing::DataMatrix::Reader reader {kRobustOptions};
+    ZXing::Result result = reader.decode(ZXing::HybridBinarizer(ZXing::ImageView   ( drawer_output.data
+                                                                                    , drawer_output.cols
+                                                                                    , drawer_output.rows
+                                                                                    , improc::DataMatrixDrawer::kImageFormat
+                                                                                    , static_cast<int>(drawer_output.step) )));
+    return result.isValid() == true && result.text() == std::get<std::string>(message.value());
+}
+
+/**
+ * @brief Binarize data matrix image in a bit matrix kept per thread, reused while the image size does not change
+ * 
+ * @param drawer_output - data matrix image, possibly a region of a larger image
+ * @return const ZXing::BitMatrix& - bit matrix with the dark modules set, valid until the next call in the same thread
+ */
+const ZXing::BitMatrix& improc::DataMatrixDrawer::BinarizeImage(const cv::Mat& drawer_output)
+{
+    thread_local ZXing::BitMatrix bit_matrix {};
+    if (bit_matrix.width() != drawer_output.cols || bit_matrix.height() != drawer_output.rows)
     {
-        return false;
+        bit_matrix = ZXing::BitMatrix(drawer_output.cols,drawer_output.rows);
     }
-}
\ No newline at end of file
+    for (int pixel_y = 0; pixel_y < drawer_output.rows; pixel_y++)
+    {
+        const uint8_t* output_row_ptr = drawer_output.ptr<uint8_t>(pixel_y);
+        for (int pixel_x = 0; pixel_x < drawer_output.cols; pixel_x++)
+        {
+            bit_matrix.set(pixel_x,pixel_y,output_row_ptr[pixel_x] <= improc::DataMatrixDrawer::kBlackThreshold);
+        }
+    }
+    return bit_matrix;
+}
@@ -1,11 +1,19 @@
 #include <improc/drawer/engine/element_drawer.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 /**
  * @brief Construct a new improc::ElementDrawer object
  */
-improc::ElementDrawer::ElementDrawer()  : drawer_(std::shared_ptr<improc::BaseDrawer>())
+improc::ElementDrawer::ElementDrawer()  : drawer_(std::shared_ptr<const improc::BaseDrawer>())
                                         , rotation_(std::optional<improc::RotationType>()) 
-                                        , size_(std::optional<cv::Size>()) {};
+                                        , size_(std::optional<cv::Size>())
+                                        , drawer_type_(std::string())
+                                        , element_key_(0)
+                                        , element_config_(std::make_shared<const std::string>())
+                                        , render_cache_(std::shared_ptr<improc::RenderCache>())
+                                        , exact_tolerance_(std::optional<size_t>()) {};
 
 /**
  * @brief Construct a new improc::ElementDrawer object
@@ -29,6 +37,11 @@ improc::ElementDrawer& improc::ElementDrawer::Load(const improc::DrawerFactory&
     IMPROC_DRAWER_LOGGER_TRACE("Creating element drawer...");
     static const std::string kRotationKey = "rotation";
     static const std::string kElemSizeKey = "drawer-size";
+    static const std::string kDrawerType  = "drawer-type";
+    static const std::string kDrawerArgs  = "args";
+    static const std::string kCacheKey    = "render-cache";
+    static const std::string kExactKey    = "exact-verification";
+    static const std::string kToleranceKey = "tolerance";
     if (element_drawer_json.isMember(kRotationKey) == true)
     {
         this->rotation_ = improc::RotationType(improc::json::ReadElement<std::string>(element_drawer_json[kRotationKey]));
@@ -38,9 +51,70 @@ improc::ElementDrawer& improc::ElementDrawer::Load(const improc::DrawerFactory&
         this->size_     = improc::json::ReadPositiveSize<cv::Size>(element_drawer_json[kElemSizeKey]);
     }
     this->drawer_ = improc::BaseDrawer::Create(std::move(factory),std::move(element_drawer_json));
+    this->drawer_type_ = improc::json::ReadElement<std::string>(element_drawer_json[kDrawerType]);
+
+    // The element key only depends on the configuration that changes the element image, so element drawers 
+    // placed in different positions of a page share cached element images.
+    Json::Value element_config_json {};
+    for (const std::string& element_config_key : {kDrawerType,kDrawerArgs,kRotationKey,kElemSizeKey})
+    {
+        if (element_drawer_json.isMember(element_config_key) == true)
+        {
+            element_config_json[element_config_key] = element_drawer_json[element_config_key];
+        }
+    }
+    Json::StreamWriterBuilder writer_builder {};
+    writer_builder["indentation"] = "";
+    this->element_config_ = std::make_shared<const std::string>(Json::writeString(writer_builder,element_config_json));
+    this->element_key_    = improc::BaseDrawer::HashMessage(*this->element_config_);
+
+    this->render_cache_.reset();
+    if (element_drawer_json.isMember(kCacheKey) == true)
+    {
+        this->render_cache_ = std::make_shared<improc::RenderCache>(element_drawer_json[kCacheKey]);
+    }
+
+    this->exact_tolerance_.reset();
+    if (element_drawer_json.isMember(kExactKey) == true)
+    {
+        int exact_tolerance = 0;
+        if (element_drawer_json[kExactKey].isMember(kToleranceKey) == true)
+        {
+            exact_tolerance = improc::json::ReadElement<int>(element_drawer_json[kExactKey][kToleranceKey]);
+        }
+        if (exact_tolerance < 0)
+        {
+            std::string error_message = fmt::format("Exact verification tolerance should be a non-negative number of pixels. {} was gave",exact_tolerance);
+            IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+        this->exact_tolerance_ = static_cast<size_t>(exact_tolerance);
+    }
     return (*this);
 }
 
+/**
+ * @brief Check if another element drawer draws the same element, i.e., it shares the base drawer and has 
+ * the same rotation and size
+ * 
+ * @param element_drawer - element drawer to compare
+ * @return true if both element drawers draw the same output for any message, share the render cache and verify 
+ * with the same exact verification tolerance
+ */
+bool improc::ElementDrawer::IsSameElement(const improc::ElementDrawer& element_drawer) const
+{
+    if (   this->drawer_ != element_drawer.drawer_ || this->size_ != element_drawer.size_ || this->render_cache_ != element_drawer.render_cache_
+        || this->exact_tolerance_ != element_drawer.exact_tolerance_ )
+    {
+        return false;
+    }
+    if (this->rotation_.has_value() == false || element_drawer.rotation_.has_value() == false)
+    {
+        return this->rotation_.has_value() == element_drawer.rotation_.has_value();
+    }
+    return this->rotation_.value() == element_drawer.rotation_.value();
+}
+
 /**
  * @brief Obtain scale considering current size and expect size
  * 
@@ -64,7 +138,53 @@ unsigned int improc::ElementDrawer::GetScale(const cv::Size& current_size, const
 }
 
 /**
- * @brief Draw element
+ * @brief Expand each pixel of the drawer output into a scale x scale block of the element image. 
+ * This is equivalent to a nearest neighbor resize by an integer factor. Each output row is filled once and 
+ * copied to the remaining rows of its block, so the element image is written in a single pass.
+ * 
+ * @param drawer_output - base drawer output, possibly rotated
+ * @param scale - integer scale factor
+ * @param element_image - image with the size of the drawer output multiplied by scale, possibly a region of a larger image
+ */
+void improc::ElementDrawer::ScaleInto(const cv::Mat& drawer_output, unsigned int scale, cv::Mat& element_image)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Scaling drawer output...");
+    if (drawer_output.type() != improc::BaseDrawer::kImageDataType)
+    {
+        cv::resize(drawer_output,element_image,element_image.size(),0,0,cv::INTER_NEAREST);
+        return;
+    }
+
+    for (int output_y = 0; output_y < drawer_output.rows; output_y++)
+    {
+        const uint8_t* output_row_ptr  = drawer_output.ptr<uint8_t>(output_y);
+        uint8_t*       element_row_ptr = element_image.ptr<uint8_t>(output_y * scale);
+        for (int output_x = 0; output_x < drawer_output.cols; output_x++)
+        {
+            std::fill_n(element_row_ptr + output_x * scale,scale,output_row_ptr[output_x]);
+        }
+        for (unsigned int block_y = 1; block_y < scale; block_y++)
+        {
+            std::copy_n(element_row_ptr,element_image.cols,element_image.ptr<uint8_t>(output_y * scale + block_y));
+        }
+    }
+}
+
+/**
+ * @brief Obtain render cache key of an element image
+ * 
+ * @param message - message to be considered in element
+ * @return std::uint64_t - hash of element configuration combined with hash of message
+ */
+std::uint64_t improc::ElementDrawer::GetCacheKey(const std::optional<improc::DrawerVariant>& message) const
+{
+    std::uint64_t message_hash = improc::BaseDrawer::HashMessage(std::move(message));
+    return this->element_key_ ^ (message_hash + 0x9e3779b97f4a7c15ULL + (this->element_key_ << 6) + (this->element_key_ >> 2));
+}
+
+/**
+ * @brief Draw element. 
+ * With a render cache, the element image is copied from the cache whenever the message was drawn before.
  * 
  * @param message - message to be considered in element
  * @return cv::Mat - element image
@@ -78,7 +198,30 @@ cv::Mat improc::ElementDrawer::Draw(const std::optional<improc::DrawerVariant>&
         IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
         throw improc::processing_flow_error(std::move(error_message));
     }
+    if (this->render_cache_ == nullptr)
+    {
+        return this->DrawElement(std::move(message));
+    }
+
+    std::uint64_t          cache_key    = this->GetCacheKey(message);
+    std::optional<cv::Mat> cached_image = this->render_cache_->Find(cache_key,*this->element_config_,message);
+    if (cached_image.has_value() == true)
+    {
+        return cached_image.value().clone();
+    }
+    cv::Mat element_image = this->DrawElement(message);
+    this->render_cache_->Insert(cache_key,this->element_config_,message,element_image);
+    return element_image;
+}
 
+/**
+ * @brief Draw element with the base drawer, rotating and resizing its output
+ * 
+ * @param message - message to be considered in element
+ * @return cv::Mat - element image
+ */
+cv::Mat improc::ElementDrawer::DrawElement(const std::optional<improc::DrawerVariant>& message) const
+{
     cv::Mat drawer_output = this->drawer_->Draw(std::move(message));
     if (this->rotation_.has_value() == true)
     {
@@ -87,14 +230,187 @@ cv::Mat improc::ElementDrawer::Draw(const std::optional<improc::DrawerVariant>&
     if (this->size_.has_value() == true)
     {
         unsigned int scale = improc::ElementDrawer::GetScale(drawer_output.size(),this->size_.value());
-        cv::resize(drawer_output,drawer_output,cv::Size(),scale,scale,cv::INTER_NEAREST);
+        cv::Mat element_image (drawer_output.rows * scale,drawer_output.cols * scale,drawer_output.type());
+        improc::ElementDrawer::ScaleInto(drawer_output,scale,element_image);
+        drawer_output = std::move(element_image);
     }
     IMPROC_DRAWER_LOGGER_DEBUG("Drawing element with size width = {}, height = {}", drawer_output.cols, drawer_output.rows);
     return drawer_output;
 }
 
 /**
- * @brief Verify element
+ * @brief Draw element directly in a region of interest. 
+ * Without rotation and resizing, the base drawer draws directly in the region of interest. Otherwise, the 
+ * base drawer output is rotated and resized directly into the region of interest. With a render cache, 
+ * the element image is copied from the cache whenever the message was drawn before.
+ * 
+ * @param roi - region of interest with the size of the element image
+ * @param message - message to be considered in element
+ */
+void improc::ElementDrawer::DrawInto(cv::Mat& roi, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing element into region of interest...");
+    if (this->drawer_ == nullptr)
+    {
+        std::string error_message = "Base drawer not defined when calling ElementDrawer::DrawInto method";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    if (this->render_cache_ == nullptr)
+    {
+        this->DrawElementInto(roi,std::move(message));
+        return;
+    }
+
+    std::uint64_t          cache_key    = this->GetCacheKey(message);
+    std::optional<cv::Mat> cached_image = this->render_cache_->Find(cache_key,*this->element_config_,message);
+    if (cached_image.has_value() == false)
+    {
+        this->DrawElementInto(roi,message);
+        this->render_cache_->Insert(cache_key,this->element_config_,message,roi);
+        return;
+    }
+    if (roi.size() != cached_image.value().size() || roi.type() != cached_image.value().type())
+    {
+        std::string error_message = fmt::format ( "Region of interest (w={},h={}) should have the size of the element image (w={},h={}) and the drawer data type"
+                                                , roi.cols, roi.rows, cached_image.value().cols, cached_image.value().rows );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    cached_image.value().copyTo(roi);
+}
+
+/**
+ * @brief Draw element directly in a region of interest with the base drawer, rotating and resizing its output
+ * 
+ * @param roi - region of interest with the size of the element image
+ * @param message - message to be considered in element
+ */
+void improc::ElementDrawer::DrawElementInto(cv::Mat& roi, const std::optional<improc::DrawerVariant>& message) const
+{
+    if (this->rotation_.has_value() == false && this->size_.has_value() == false)
+    {
+        this->drawer_->DrawInto(roi,std::move(message));
+        return;
+    }
+
+    cv::Mat drawer_output = this->drawer_->Draw(std::move(message));
+    if (this->rotation_.has_value() == true)
+    {
+        drawer_output = this->rotation_.value().Apply(drawer_output);
+    }
+    unsigned int scale = 1;
+    if (this->size_.has_value() == true)
+    {
+        scale = improc::ElementDrawer::GetScale(drawer_output.size(),this->size_.value());
+    }
+    cv::Size element_size {drawer_output.cols * static_cast<int>(scale),drawer_output.rows * static_cast<int>(scale)};
+    if (roi.size() != element_size || roi.type() != drawer_output.type())
+    {
+        std::string error_message = fmt::format ( "Region of interest (w={},h={}) should have the size of the element image (w={},h={}) and the drawer data type"
+                                                , roi.cols, roi.rows, element_size.width, element_size.height );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    IMPROC_DRAWER_LOGGER_DEBUG("Drawing element with size width = {}, height = {}", element_size.width, element_size.height);
+    if (scale > 1)
+    {
+        improc::ElementDrawer::ScaleInto(drawer_output,scale,roi);
+    }
+    else
+    {
+        drawer_output.copyTo(roi);
+    }
+}
+
+/**
+ * @brief Obtain size of element image without drawing it
+ * 
+ * @param message - message to be considered in element
+ * @return cv::Size - size of element image
+ */
+cv::Size improc::ElementDrawer::GetOutputSize(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining element size...");
+    cv::Size     native_size   = this->GetNativeSize(std::move(message));
+    unsigned int element_scale = this->GetScaleFactor(native_size);
+    return cv::Size(native_size.width * element_scale,native_size.height * element_scale);
+}
+
+/**
+ * @brief Obtain size of base drawer output after rotation and before resizing, without drawing it
+ * 
+ * @param message - message to be considered in element
+ * @return cv::Size - native size of element image
+ */
+cv::Size improc::ElementDrawer::GetNativeSize(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining element native size...");
+    if (this->drawer_ == nullptr)
+    {
+        std::string error_message = "Base drawer not defined when calling ElementDrawer::GetNativeSize method";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+
+    cv::Size native_size = this->drawer_->GetOutputSize(std::move(message));
+    if (this->rotation_.has_value() == true)
+    {
+        // Rotations by 90 and 270 degrees swap width and height
+        improc::RotationType::Value rotation = this->rotation_.value();
+        if (rotation == improc::RotationType::Value::k90Deg || rotation == improc::RotationType::Value::k270Deg)
+        {
+            native_size = cv::Size(native_size.height,native_size.width);
+        }
+    }
+    return native_size;
+}
+
+/**
+ * @brief Obtain scale factor applied to the element native size
+ * 
+ * @param native_size - size of base drawer output after rotation
+ * @return unsigned int - scale factor, 1 if element drawer has no size
+ */
+unsigned int improc::ElementDrawer::GetScaleFactor(const cv::Size& native_size) const
+{
+    if (this->size_.has_value() == false)
+    {
+        return 1;
+    }
+    return improc::ElementDrawer::GetScale(native_size,this->size_.value());
+}
+
+/**
+ * @brief Obtain scale factor of an element image drawn with a message, validating a known scale factor. 
+ * The known scale factor is kept when the native size of the message scaled by it has the element size, 
+ * otherwise the scale factor is computed again from the element size and the native size of the message. 
+ * Element sizes that are not a multiple of the native size keep the known scale factor, so the element 
+ * image fails verification instead of throwing.
+ * 
+ * @param element_size - size of element image
+ * @param element_scale - known scale factor, obtained when allocating
+ * @param message - message to be considered in element
+ * @return unsigned int - scale factor of element image
+ */
+unsigned int improc::ElementDrawer::GetScaleFactor(const cv::Size& element_size, unsigned int element_scale, const std::optional<improc::DrawerVariant>& message) const
+{
+    cv::Size native_size = this->GetNativeSize(message);
+    if (   native_size.width  <= 0 || element_size.width  % native_size.width  != 0
+        || native_size.height <= 0 || element_size.height % native_size.height != 0
+        || element_size.width / native_size.width != element_size.height / native_size.height )
+    {
+        IMPROC_DRAWER_LOGGER_DEBUG("Element size is not a multiple of the native size of the message, keeping scale factor {}",element_scale);
+        return element_scale;
+    }
+    return static_cast<unsigned int>(element_size.width / native_size.width);
+}
+
+/**
+ * @brief Verify element. 
+ * The scale factor is obtained from the element native size, which only draws the element when the base 
+ * drawer cannot compute its output size without drawing.
  * 
  * @param drawer_output - element image
  * @param message - message to be considered in element
@@ -109,26 +425,161 @@ bool improc::ElementDrawer::Verify(const cv::Mat& drawer_output, const std::opti
         IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
         throw improc::processing_flow_error(std::move(error_message));
     }
+    return this->Verify(drawer_output,this->GetScaleFactor(this->GetNativeSize(message)),std::move(message));
+}
 
-    cv::Mat drawer_transformed = drawer_output.clone();
-    if (this->size_.has_value() == true)
+/**
+ * @brief Verify element with a known scale factor, without drawing the element. 
+ * With exact verification, the element image is compared with the expected element image before decoding it.
+ * 
+ * @param element_image - element image, possibly a region of a larger image
+ * @param element_scale - scale factor of element, obtained when allocating
+ * @param message - message to be considered in element
+ * @return bool - true if element is correct, false otherwise.
+ */
+bool improc::ElementDrawer::Verify(const cv::Mat& element_image, unsigned int element_scale, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying element with scale factor...");
+    if (this->drawer_ == nullptr)
+    {
+        std::string error_message = "Base drawer not defined when calling ElementDrawer::Verify method";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    if (element_scale == 0)
+    {
+        std::string error_message = "Scale factor should be greater than zero when verifying element";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (element_image.cols % element_scale != 0 || element_image.rows % element_scale != 0)
+    {
+        IMPROC_DRAWER_LOGGER_DEBUG("Element image with width = {}, height = {} is not a multiple of scale factor {}",element_image.cols,element_image.rows,element_scale);
+        return false;
+    }
+    if (this->exact_tolerance_.has_value() == true && this->IsExactElement(element_image,element_scale,message) == true)
+    {
+        return true;
+    }
+
+    if (element_scale == 1 && this->rotation_.has_value() == false)
+    {
+        return this->drawer_->Verify(element_image,std::move(message));
+    }
+
+    thread_local cv::Mat native_image {};
+    const cv::Mat* drawer_output = &element_image;
+    if (element_scale > 1)
     {
-        unsigned int scale = 0;
+        cv::resize  ( element_image,native_image,cv::Size(element_image.cols / element_scale,element_image.rows / element_scale)
+                    , 0,0,cv::INTER_NEAREST );
+        drawer_output = &native_image;
+    }
+    if (this->rotation_.has_value() == true)
+    {
+        cv::Mat drawer_rotated = this->rotation_.value().ApplyInverse(*drawer_output);
+        IMPROC_DRAWER_LOGGER_DEBUG("Verifying element with size width = {}, height = {}", drawer_rotated.cols, drawer_rotated.rows);
+        return this->drawer_->Verify(drawer_rotated,std::move(message));
+    }
+    IMPROC_DRAWER_LOGGER_DEBUG("Verifying element with size width = {}, height = {}", drawer_output->cols, drawer_output->rows);
+    return this->drawer_->Verify(*drawer_output,std::move(message));
+}
+
+/**
+ * @brief Check if element image matches the expected element image, up to the exact verification tolerance.
+ * The expected element image is taken from the render cache whenever available, without counting the lookup 
+ * in the render cache statistics. Otherwise, the base drawer output is drawn once, its size scaled by the 
+ * element scale factor is compared with the element image size, and it is resized in an image kept per thread 
+ * and reused.
+ * 
+ * @param element_image - element image, possibly a region of a larger image
+ * @param element_scale - scale factor of element
+ * @param message - message to be considered in element
+ * @return bool - true if the number of different pixels is not greater than the tolerance, false otherwise.
+ */
+bool improc::ElementDrawer::IsExactElement(const cv::Mat& element_image, unsigned int element_scale, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Comparing element with expected element image...");
+    if (element_image.type() != improc::BaseDrawer::kImageDataType)
+    {
+        return false;
+    }
+
+    thread_local cv::Mat expected_buffer {};
+    cv::Mat expected_image {};
+    std::uint64_t cache_key = 0;
+    if (this->render_cache_ != nullptr)
+    {
+        cache_key = this->GetCacheKey(message);
+        std::optional<cv::Mat> cached_image = this->render_cache_->Peek(cache_key,*this->element_config_,message);
+        if (cached_image.has_value() == true)
+        {
+            expected_image = std::move(cached_image.value());
+        }
+    }
+    if (expected_image.empty() == true)
+    {
+        cv::Mat drawer_output = this->drawer_->Draw(message);
         if (this->rotation_.has_value() == true)
         {
-            scale = improc::ElementDrawer::GetScale ( this->rotation_.value().Apply(this->drawer_->Draw(message)).size()
-                                                    , this->size_.value() );
+            drawer_output = this->rotation_.value().Apply(drawer_output);
+        }
+        if (   drawer_output.cols * static_cast<int>(element_scale) != element_image.cols 
+            || drawer_output.rows * static_cast<int>(element_scale) != element_image.rows 
+            || drawer_output.type() != improc::BaseDrawer::kImageDataType )
+        {
+            return false;
+        }
+        expected_buffer.create(element_image.size(),improc::BaseDrawer::kImageDataType);
+        if (element_scale > 1)
+        {
+            improc::ElementDrawer::ScaleInto(drawer_output,element_scale,expected_buffer);
         }
         else
         {
-            scale = improc::ElementDrawer::GetScale(this->drawer_->Draw(message).size(),this->size_.value());
+            drawer_output.copyTo(expected_buffer);
         }
-        cv::resize(drawer_transformed,drawer_transformed,cv::Size(),1.0/scale,1.0/scale,cv::INTER_NEAREST);
+        // Only element images drawn with the element drawer scale factor are the images drawn for the message
+        if (this->render_cache_ != nullptr && this->GetScaleFactor(drawer_output.size()) == element_scale)
+        {
+            this->render_cache_->Insert(cache_key,this->element_config_,message,expected_buffer);
+        }
+        expected_image = expected_buffer;
     }
-    if (this->rotation_.has_value() == true)
+    else if (expected_image.size() != element_image.size())
     {
-        drawer_transformed = this->rotation_.value().ApplyInverse(drawer_transformed);
+        return false;
+    }
+
+    size_t different_pixels = improc::ElementDrawer::CountDifferentPixels(element_image,expected_image,this->exact_tolerance_.value());
+    IMPROC_DRAWER_LOGGER_DEBUG("Element image differs from expected element image in {} pixels",different_pixels);
+    return different_pixels <= this->exact_tolerance_.value();
+}
+
+/**
+ * @brief Count different pixels between two images with the same size and drawer data type. 
+ * Equal rows are skipped with a memory comparison and counting stops once the maximum is exceeded.
+ * 
+ * @param element_image - element image, possibly a region of a larger image
+ * @param expected_image - expected element image
+ * @param max_differences - number of different pixels accepted
+ * @return size_t - number of different pixels, counted up to the first row exceeding max_differences
+ */
+size_t improc::ElementDrawer::CountDifferentPixels(const cv::Mat& element_image, const cv::Mat& expected_image, size_t max_differences)
+{
+    size_t different_pixels = 0;
+    for (int row = 0; row < element_image.rows && different_pixels <= max_differences; row++)
+    {
+        const uint8_t* element_row_ptr  = element_image.ptr<uint8_t>(row);
+        const uint8_t* expected_row_ptr = expected_image.ptr<uint8_t>(row);
+        if (std::memcmp(element_row_ptr,expected_row_ptr,element_image.cols) == 0)
+        {
+            continue;
+        }
+        for (int col = 0; col < element_image.cols; col++)
+        {
+            different_pixels += element_row_ptr[col] != expected_row_ptr[col];
+        }
     }
-    IMPROC_DRAWER_LOGGER_DEBUG("Verifying element with size width = {}, height = {}", drawer_transformed.cols, drawer_transformed.rows);
-    return this->drawer_->Verify(std::move(drawer_transformed),std::move(message));
+    return different_pixels;
 }
@@ -0,0 +1,118 @@
+#include <improc/drawer/drawer_types/fiducial_drawer.hpp>
+
+/**
+ * @brief Construct a new improc::FiducialDrawer object
+ */
+improc::FiducialDrawer::FiducialDrawer() : improc::BaseDrawer() {};
+
+/**
+ * @brief Construct a new improc::FiducialDrawer object
+ * 
+ * @param drawer_json - configuration json for fiducial drawer
+ */
+improc::FiducialDrawer::FiducialDrawer(const Json::Value& drawer_json) : improc::FiducialDrawer() 
+{
+    this->Load(std::move(drawer_json));
+}
+
+/**
+ * @brief Load configuration for a improc::FiducialDrawer object. 
+ * The fiducial marker has no configuration.
+ * 
+ * @param drawer_json - configuration json for fiducial drawer
+ */
+improc::FiducialDrawer& improc::FiducialDrawer::Load(const Json::Value& drawer_json)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Creating fiducial drawer...");
+    return (*this);
+}
+
+/**
+ * @brief Draw fiducial marker
+ * 
+ * @param message - message for fiducial marker
+ * @return cv::Mat - fiducial marker image with one pixel per module
+ */
+cv::Mat improc::FiducialDrawer::Draw(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing fiducial marker...");
+    cv::Mat fiducial (improc::FiducialDrawer::kNumberModules,improc::FiducialDrawer::kNumberModules,improc::BaseDrawer::kImageDataType);
+    this->DrawInto(fiducial,std::move(message));
+    return fiducial;
+}
+
+/**
+ * @brief Draw fiducial marker directly in a region of interest
+ * 
+ * @param roi - region of interest with the size of the fiducial marker image
+ * @param message - message for fiducial marker
+ */
+void improc::FiducialDrawer::DrawInto(cv::Mat& roi, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing fiducial marker into region of interest...");
+    improc::BaseDrawer::ValidateRoi(roi,this->GetOutputSize(std::move(message)));
+    for (int module_y = 0; module_y < improc::FiducialDrawer::kNumberModules; module_y++)
+    {
+        uint8_t* roi_row_ptr = roi.ptr<uint8_t>(module_y);
+        for (int module_x = 0; module_x < improc::FiducialDrawer::kNumberModules; module_x++)
+        {
+            roi_row_ptr[module_x] = improc::FiducialDrawer::IsDarkModule(module_x,module_y) == true ? improc::BaseDrawer::kBlackValue 
+                                                                                                     : improc::BaseDrawer::kWhiteValue;
+        }
+    }
+}
+
+/**
+ * @brief Obtain size of fiducial marker image
+ * 
+ * @param message - message for fiducial marker
+ * @return cv::Size - size of fiducial marker image
+ */
+cv::Size improc::FiducialDrawer::GetOutputSize(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining fiducial marker size...");
+    return cv::Size(improc::FiducialDrawer::kNumberModules,improc::FiducialDrawer::kNumberModules);
+}
+
+/**
+ * @brief Verify fiducial marker. 
+ * A few modules may differ from the fiducial marker, since modules of a resampled scan are read near their borders.
+ * 
+ * @param drawer_output - fiducial marker image
+ * @param message - message for fiducial marker
+ * @return bool - true if image has the fiducial marker modules, false otherwise.
+ */
+bool improc::FiducialDrawer::Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying fiducial marker...");
+    if (drawer_output.size() != this->GetOutputSize(std::move(message)) || drawer_output.type() != improc::BaseDrawer::kImageDataType)
+    {
+        return false;
+    }
+    int module_errors = 0;
+    for (int module_y = 0; module_y < improc::FiducialDrawer::kNumberModules; module_y++)
+    {
+        const uint8_t* output_row_ptr = drawer_output.ptr<uint8_t>(module_y);
+        for (int module_x = 0; module_x < improc::FiducialDrawer::kNumberModules; module_x++)
+        {
+            if ((output_row_ptr[module_x] < improc::FiducialDrawer::kGrayThreshold) != improc::FiducialDrawer::IsDarkModule(module_x,module_y))
+            {
+                module_errors++;
+            }
+        }
+    }
+    return module_errors <= improc::FiducialDrawer::kMaxModuleErrors;
+}
+
+/**
+ * @brief Check if a module of the fiducial marker is dark
+ * 
+ * @param module_x - module column
+ * @param module_y - module row
+ * @return bool - true if module belongs to the outer ring or to the center of the fiducial marker, false otherwise.
+ */
+bool improc::FiducialDrawer::IsDarkModule(int module_x, int module_y)
+{
+    int ring = std::max(std::abs(module_x - improc::FiducialDrawer::kNumberModules / 2),std::abs(module_y - improc::FiducialDrawer::kNumberModules / 2));
+    return ring != improc::FiducialDrawer::kNumberModules / 2 - 1;
+}
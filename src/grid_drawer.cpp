@@ -3,7 +3,11 @@
 /**
  * @brief Construct a new improc::GridDrawer object
  */
-improc::GridDrawer::GridDrawer(): improc::PageDrawer() {};
+improc::GridDrawer::GridDrawer(): improc::PageDrawer()
+                                , cell_elements_(std::vector<improc::PageElementDrawer>())
+                                , cell_size_(cv::Size())
+                                , grid_number_(cv::Point())
+                                , cell_offsets_(std::vector<cv::Point>()) {};
 
 /**
  * @brief Construct a new improc::GridDrawer object
@@ -46,27 +50,102 @@ improc::GridDrawer& improc::GridDrawer::Load(const improc::DrawerFactory& factor
         IMPROC_DRAWER_LOGGER_ERROR("ERROR_03: " + error_message);
         throw improc::json_error(std::move(error_message));
     }
-    cv::Point grid_number  = improc::GridDrawer::ParseGridNumber (grid_drawer_json[kGridNumberKey] );
+    this->grid_number_     = improc::GridDrawer::ParseGridNumber (grid_drawer_json[kGridNumberKey] );
     cv::Point grid_spacing = improc::GridDrawer::ParseGridSpacing(grid_drawer_json[kGridSpacingKey]);
     
     improc::PageDrawer cell {std::move(factory), grid_drawer_json[kGridCellKey]};
-    cv::Size cell_size = cell.get_page_size();
-    this->page_size_   = cv::Size   ( grid_number.x * cell_size.width  + (grid_number.x - 1) * grid_spacing.x
-                                    , grid_number.y * cell_size.height + (grid_number.y - 1) * grid_spacing.y );
-    this->elements_.clear();
-    for (size_t cell_idx_x = 0; cell_idx_x < grid_number.x; cell_idx_x++)
-    {
-        int top_left_x = cell_idx_x * cell_size.width + cell_idx_x * grid_spacing.x;
-        for (size_t cell_idx_y = 0; cell_idx_y < grid_number.y; cell_idx_y++)
+    this->cell_elements_ = cell.ExtractPageElements();
+    this->cell_size_     = cell.get_page_size();
+    this->page_size_     = cv::Size ( this->grid_number_.x * this->cell_size_.width  + (this->grid_number_.x - 1) * grid_spacing.x
+                                    , this->grid_number_.y * this->cell_size_.height + (this->grid_number_.y - 1) * grid_spacing.y );
+    this->ClearPageElements();
+    this->cell_offsets_.clear();
+    this->cell_offsets_.reserve(this->grid_number_.x * this->grid_number_.y);
+    for (size_t cell_idx_x = 0; cell_idx_x < this->grid_number_.x; cell_idx_x++)
+    {
+        int top_left_x = cell_idx_x * this->cell_size_.width + cell_idx_x * grid_spacing.x;
+        for (size_t cell_idx_y = 0; cell_idx_y < this->grid_number_.y; cell_idx_y++)
         {
-            int top_left_y = cell_idx_y * cell_size.height + cell_idx_y * grid_spacing.y;
-            std::list<improc::PageElementDrawer> grid_elements = improc::PageElementDrawer::IncrementTopLeftBy(cell.get_page_elements(),cv::Point(top_left_x,top_left_y),this->page_size_);
-            this->elements_.insert(this->elements_.end(),grid_elements.begin(),grid_elements.end());
+            int top_left_y = cell_idx_y * this->cell_size_.height + cell_idx_y * grid_spacing.y;
+            this->cell_offsets_.push_back(cv::Point(top_left_x,top_left_y));
         }
     }
+    this->AppendCellSlots();
     return (*this);
 }
 
+/**
+ * @brief Append slots of the cell page elements without creating them. 
+ * Cell page elements are only created when allocating, so loading the grid is proportional to the cell size.
+ */
+improc::GridDrawer& improc::GridDrawer::AppendCellSlots()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Appending slots of cell page elements...");
+    for (size_t cell_idx = 0; cell_idx < this->cell_offsets_.size(); cell_idx++)
+    {
+        std::unordered_map<std::string,size_t> cell_slots {};
+        for (size_t elem_idx = 0; elem_idx < this->cell_elements_.size(); elem_idx++)
+        {
+            const std::string& element_id = this->cell_elements_[elem_idx].get_element_id();
+            if (element_id.empty() == false)
+            {
+                cell_slots.emplace(this->GetCellElementId(element_id,cell_idx),elem_idx);
+            }
+        }
+        this->AppendElementSlots(cell_slots,this->cell_elements_.size());
+    }
+    return (*this);
+}
+
+/**
+ * @brief Append page elements of every cell created from the cell template
+ */
+improc::GridDrawer& improc::GridDrawer::AppendCellElements()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Appending cell page elements...");
+    this->ClearPageElements();
+    for (size_t cell_idx = 0; cell_idx < this->cell_offsets_.size(); cell_idx++)
+    {
+        this->AppendPageElements(this->CreateCellElements(cell_idx));
+    }
+    return (*this);
+}
+
+/**
+ * @brief Create page elements of a cell from the cell template. 
+ * Page elements are moved to the cell offset and their identifiers qualified with the cell position.
+ * 
+ * @param cell_idx - index of cell, following the order of cell offsets
+ * @return std::vector<improc::PageElementDrawer> - page elements of cell
+ */
+std::vector<improc::PageElementDrawer> improc::GridDrawer::CreateCellElements(size_t cell_idx) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Creating page elements of cell {}...",cell_idx);
+    std::vector<improc::PageElementDrawer> cell_elements = improc::PageElementDrawer::IncrementTopLeftBy(std::vector<improc::PageElementDrawer>(this->cell_elements_),this->cell_offsets_[cell_idx],this->page_size_);
+    for (improc::PageElementDrawer& elem : cell_elements)
+    {
+        if (elem.get_element_id().empty() == false)
+        {
+            elem.set_element_id(this->GetCellElementId(elem.get_element_id(),cell_idx));
+        }
+    }
+    return cell_elements;
+}
+
+/**
+ * @brief Qualify identifier of a cell page element with the cell position in the grid, as in id[x,y]
+ * 
+ * @param element_id - identifier of page element in cell template
+ * @param cell_idx - index of cell, following the order of cell offsets
+ * @return std::string - identifier of page element in grid
+ */
+std::string improc::GridDrawer::GetCellElementId(const std::string& element_id, size_t cell_idx) const
+{
+    size_t cell_idx_x = cell_idx / this->grid_number_.y;
+    size_t cell_idx_y = cell_idx % this->grid_number_.y;
+    return fmt::format("{}[{},{}]",element_id,cell_idx_x,cell_idx_y);
+}
+
 /**
  * @brief Parse and validate grid number
  * 
@@ -138,11 +217,96 @@ inline bool improc::GridDrawer::IsSpacingValid(int spacing)
 }
 
 /**
- * @brief Allocate and initialize grid drawer
+ * @brief Allocate and initialize grid drawer.
+ * The page elements of every cell are created once from the cell template and allocated.
  */
 improc::GridDrawer& improc::GridDrawer::Allocate()
 {
     IMPROC_DRAWER_LOGGER_TRACE("Allocating grid...");
-    this->improc::PageDrawer::Allocate();
+    this->AppendCellElements();
+    this->AllocateCells();
+    return (*this);
+}
+
+/**
+ * @brief Allocate and initialize grid drawer using a render plan cache. 
+ * If the cache holds an allocation of this grid, it is restored without drawing any page element. 
+ * Otherwise, the grid is allocated from the cell template and its allocation written to the cache.
+ * 
+ * @param render_plan_cache - render plan cache of grid
+ */
+improc::GridDrawer& improc::GridDrawer::Allocate(const improc::RenderPlanCache& render_plan_cache)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Allocating grid using render plan cache...");
+    this->AppendCellElements();
+    if (this->AllocateFromCache(render_plan_cache) == false)
+    {
+        this->AllocateCells();
+        render_plan_cache.Write(*this->render_plan_);
+    }
+    return (*this);
+}
+
+/**
+ * @brief Allocate the created cell page elements from the cell template. 
+ * The cell template is allocated once and its allocation copied to every cell offset. When all static elements fit 
+ * inside the cell, they are drawn once in a cell image that is stamped to every cell offset. Otherwise, 
+ * static elements are drawn in each cell, since they may overlap neighbour cells.
+ */
+improc::GridDrawer& improc::GridDrawer::AllocateCells()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Allocating grid cells...");
+    this->page_image_ = cv::Mat(this->page_size_.height,this->page_size_.width,improc::BaseDrawer::kImageDataType,improc::BaseDrawer::kWhiteValue);
+    cv::Rect cell_box    {cv::Point(0,0),this->cell_size_};
+    bool     stamp_cell  = true;
+    for (improc::PageElementDrawer& elem : this->cell_elements_)
+    {
+        elem.Allocate();
+        if (elem.is_element_static() == true && (elem.get_element_box() & cell_box) != elem.get_element_box())
+        {
+            stamp_cell = false;
+        }
+    }
+
+    cv::Mat cell_image {};
+    if (stamp_cell == true)
+    {
+        cell_image = cv::Mat(this->cell_size_.height,this->cell_size_.width,improc::BaseDrawer::kImageDataType,improc::BaseDrawer::kWhiteValue);
+        std::for_each   ( this->cell_elements_.begin(),this->cell_elements_.end()
+                        , [&cell_image] (const improc::PageElementDrawer& elem) 
+                            {
+                                if (elem.is_element_static() == true)
+                                {
+                                    elem.Draw(cell_image);
+                                }
+                            }
+                        );
+    }
+    else
+    {
+        IMPROC_DRAWER_LOGGER_DEBUG("Static elements exceed cell. Drawing static elements per cell");
+    }
+
+    size_t number_cell_elements = this->cell_elements_.size();
+    for (size_t cell_idx = 0; cell_idx < this->cell_offsets_.size(); cell_idx++)
+    {
+        const cv::Point& cell_offset = this->cell_offsets_[cell_idx];
+        for (size_t elem_idx = 0; elem_idx < number_cell_elements; elem_idx++)
+        {
+            const improc::PageElementDrawer& cell_elem = this->cell_elements_[elem_idx];
+            improc::PageElementDrawer&       grid_elem = this->elements_[cell_idx * number_cell_elements + elem_idx];
+            grid_elem.Allocate(cell_elem.get_element_box() + cell_offset,cell_elem.get_element_scale());
+            if (stamp_cell == false && grid_elem.is_element_static() == true)
+            {
+                grid_elem.Draw(this->page_image_);
+            }
+        }
+        if (stamp_cell == true)
+        {
+            cv::Mat cell_page_image = this->page_image_(cv::Rect(cell_offset,this->cell_size_));
+            cell_image.copyTo(cell_page_image);
+        }
+    }
+    this->CompileRenderPlan();
     return (*this);
 }
@@ -42,12 +42,37 @@ improc::ImageFileDrawer& improc::ImageFileDrawer::Load(const Json::Value& drawer
  * @param message - message for image file
  * @return cv::Mat - image with content of image file
  */
-cv::Mat improc::ImageFileDrawer::Draw(const std::optional<improc::DrawerVariant>& message)
+cv::Mat improc::ImageFileDrawer::Draw(const std::optional<improc::DrawerVariant>& message) const
 {
     IMPROC_DRAWER_LOGGER_TRACE("Drawing image file content...");
     return this->image_data_;
 };
 
+/**
+ * @brief Draw image file content directly in a region of interest
+ * 
+ * @param roi - region of interest with the size of the image file content
+ * @param message - message for image file
+ */
+void improc::ImageFileDrawer::DrawInto(cv::Mat& roi, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing image file content into region of interest...");
+    improc::BaseDrawer::ValidateRoi(roi,this->image_data_.size());
+    this->image_data_.copyTo(roi);
+}
+
+/**
+ * @brief Obtain size of image file content
+ * 
+ * @param message - message for image file
+ * @return cv::Size - size of image file content
+ */
+cv::Size improc::ImageFileDrawer::GetOutputSize(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining image file content size...");
+    return this->image_data_.size();
+}
+
 /**
  * @brief Verify image content
  * 
@@ -55,7 +80,7 @@ cv::Mat improc::ImageFileDrawer::Draw(const std::optional<improc::DrawerVariant>
  * @param message - message for image file
  * @return bool - true if image content and image file content are the same, false otherwise.
  */
-bool improc::ImageFileDrawer::Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message)
+bool improc::ImageFileDrawer::Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message) const
 {
     IMPROC_DRAWER_LOGGER_TRACE("Verifying image file content...");
     // TODO: Move this logic to an image class object
@@ -3,7 +3,11 @@
 /**
  * @brief Construct a new improc::LayoutDrawer object
  */
-improc::LayoutDrawer::LayoutDrawer(): improc::PageDrawer() {};
+improc::LayoutDrawer::LayoutDrawer(): improc::PageDrawer()
+                                    , page_drawers_(std::vector<std::shared_ptr<improc::PageDrawer>>())
+                                    , page_drawer_types_(std::vector<improc::PageDrawerType>())
+                                    , page_drawer_top_lefts_(std::vector<cv::Point>())
+                                    , page_drawer_ids_(std::vector<std::string>()) {};
 
 /**
  * @brief Construct a new improc::LayoutDrawer object
@@ -25,7 +29,11 @@ improc::LayoutDrawer::LayoutDrawer(const improc::DrawerFactory& factory, const J
 improc::LayoutDrawer& improc::LayoutDrawer::Load(const improc::DrawerFactory& factory, const Json::Value& layout_drawer_json)
 {
     IMPROC_DRAWER_LOGGER_TRACE("Creating layout drawer...");
-    this->elements_.clear();
+    this->ClearPageElements();
+    this->page_drawers_.clear();
+    this->page_drawer_types_.clear();
+    this->page_drawer_top_lefts_.clear();
+    this->page_drawer_ids_.clear();
     if (layout_drawer_json.isArray() == true)
     {
         std::for_each   ( layout_drawer_json.begin(), layout_drawer_json.end()
@@ -49,6 +57,7 @@ improc::LayoutDrawer& improc::LayoutDrawer::ParsePageTypeDrawer(const improc::Dr
     IMPROC_DRAWER_LOGGER_TRACE("Parsing page type drawer...");
     static const std::string kPageDrawerTypeKey = "page-drawer-type";
     static const std::string kTopLeftKey        = "top-left";
+    static const std::string kIdKey             = "id";
     if (page_drawer_type_json.isMember(kPageDrawerTypeKey) == false)
     {
         std::string error_message = fmt::format("Key {} is missing from layout drawer json",kPageDrawerTypeKey);
@@ -80,9 +89,102 @@ improc::LayoutDrawer& improc::LayoutDrawer::ParsePageTypeDrawer(const improc::Dr
         throw improc::value_error(std::move(error_message));
     }
 
+    std::string page_drawer_id {};
+    if (page_drawer_type_json.isMember(kIdKey) == true)
+    {
+        page_drawer_id = improc::json::ReadElement<std::string>(page_drawer_type_json[kIdKey]);
+    }
+    std::unordered_map<std::string,size_t> page_drawer_slots {};
+    for (const std::pair<const std::string,size_t>& element_slot : page_drawer->get_element_slots())
+    {
+        page_drawer_slots.emplace(improc::LayoutDrawer::GetLayoutElementId(page_drawer_id,element_slot.first),element_slot.second);
+    }
     this->CorrectLayoutSize(top_left,page_drawer->get_page_size());
-    std::list<improc::PageElementDrawer> page_elements = improc::PageElementDrawer::IncrementTopLeftBy(page_drawer->get_page_elements(),std::move(top_left),this->page_size_);
-    this->elements_.insert(this->elements_.end(),page_elements.begin(),page_elements.end());
+    this->AppendElementSlots(page_drawer_slots,page_drawer->get_number_elements());
+    this->page_drawers_.push_back(std::move(page_drawer));
+    this->page_drawer_types_.push_back(std::move(page_drawer_type));
+    this->page_drawer_top_lefts_.push_back(std::move(top_left));
+    this->page_drawer_ids_.push_back(std::move(page_drawer_id));
+    return (*this);
+}
+
+/**
+ * @brief Prefix identifier of a page drawer element with the page drawer identifier, as in pageid.id
+ * 
+ * @param page_drawer_id - identifier of page drawer, empty if page drawer has no identifier
+ * @param element_id - identifier of page element in page drawer
+ * @return std::string - identifier of page element in layout
+ */
+std::string improc::LayoutDrawer::GetLayoutElementId(const std::string& page_drawer_id, const std::string& element_id)
+{
+    if (page_drawer_id.empty() == true || element_id.empty() == true)
+    {
+        return element_id;
+    }
+    return page_drawer_id + "." + element_id;
+}
+
+/**
+ * @brief Compose layout page elements from the page drawer components. 
+ * Grid drawers are allocated from their cell template before their page elements are moved to the layout, 
+ * so their static elements raster is stamped once per cell. Page elements of page drawers are copied to the layout 
+ * and, when drawing static elements, allocated and drawn as in a page drawer.
+ * 
+ * @param draw_static_elements - allocate and draw static elements in layout page image
+ */
+improc::LayoutDrawer& improc::LayoutDrawer::ComposeLayout(bool draw_static_elements)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Composing layout...");
+    this->ClearPageElements();
+    if (draw_static_elements == true)
+    {
+        this->page_image_ = cv::Mat(this->page_size_.height,this->page_size_.width,improc::BaseDrawer::kImageDataType,improc::BaseDrawer::kWhiteValue);
+    }
+    for (size_t page_idx = 0; page_idx < this->page_drawers_.size(); page_idx++)
+    {
+        const cv::Point& top_left = this->page_drawer_top_lefts_[page_idx];
+        std::vector<improc::PageElementDrawer> page_elements {};
+        if (this->page_drawer_types_[page_idx] == improc::PageDrawerType::kGridDrawer)
+        {
+            improc::GridDrawer& grid_drawer = static_cast<improc::GridDrawer&>(*this->page_drawers_[page_idx]);
+            cv::Mat grid_image = grid_drawer.Allocate().get_render_plan()->get_background();
+            page_elements = improc::PageElementDrawer::IncrementTopLeftBy(grid_drawer.ExtractPageElements(),top_left,this->page_size_);
+            if (draw_static_elements == true)
+            {
+                for (const improc::PageElementDrawer& elem : page_elements)
+                {
+                    if (elem.is_element_static() == true)
+                    {
+                        cv::Mat element_page_image = this->page_image_(elem.get_element_box());
+                        grid_image(elem.get_element_box() - top_left).copyTo(element_page_image);
+                    }
+                }
+            }
+        }
+        else
+        {
+            page_elements = improc::PageElementDrawer::IncrementTopLeftBy(std::vector<improc::PageElementDrawer>(this->page_drawers_[page_idx]->get_page_elements()),top_left,this->page_size_);
+            if (draw_static_elements == true)
+            {
+                for (improc::PageElementDrawer& elem : page_elements)
+                {
+                    elem.Allocate();
+                    if (elem.is_element_static() == true)
+                    {
+                        elem.Draw(this->page_image_);
+                    }
+                }
+            }
+        }
+        for (improc::PageElementDrawer& elem : page_elements)
+        {
+            if (elem.get_element_id().empty() == false)
+            {
+                elem.set_element_id(improc::LayoutDrawer::GetLayoutElementId(this->page_drawer_ids_[page_idx],elem.get_element_id()));
+            }
+        }
+        this->AppendPageElements(std::move(page_elements));
+    }
     return (*this);
 }
 
@@ -144,12 +246,33 @@ inline bool improc::LayoutDrawer::IsPixelPositionValid(int pixel_position)
 }
 
 /**
- * @brief Allocate and initialize layout drawer
+ * @brief Allocate and initialize layout drawer. 
+ * Grid drawers in the layout are allocated from their cell template.
  */
 improc::LayoutDrawer& improc::LayoutDrawer::Allocate()
 {
     IMPROC_DRAWER_LOGGER_TRACE("Allocating layout...");
-    this->improc::PageDrawer::Allocate();
+    this->ComposeLayout(true);
+    this->CompileRenderPlan();
+    return (*this);
+}
+
+/**
+ * @brief Allocate and initialize layout drawer using a render plan cache. 
+ * The layout page elements are composed to be matched with the cache, which allocates grid drawers in the layout. 
+ * If the cache does not match the layout, the layout is allocated and its allocation written to the cache.
+ * 
+ * @param render_plan_cache - render plan cache of layout
+ */
+improc::LayoutDrawer& improc::LayoutDrawer::Allocate(const improc::RenderPlanCache& render_plan_cache)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Allocating layout using render plan cache...");
+    this->ComposeLayout(false);
+    if (this->AllocateFromCache(render_plan_cache) == false)
+    {
+        this->Allocate();
+        render_plan_cache.Write(*this->render_plan_);
+    }
     return (*this);
 }
 
@@ -165,6 +288,69 @@ cv::Mat improc::LayoutDrawer::Draw(const std::list<std::optional<improc::DrawerV
     return this->improc::PageDrawer::Draw(std::move(context));
 }
 
+/**
+ * @brief Draw layout using a worker pool to draw layout elements concurrently
+ * 
+ * @param context - list of messages to be considered in layout
+ * @param worker_pool - worker pool used to draw the layout elements
+ * @return cv::Mat - page image with layout elements drawed
+ */
+cv::Mat improc::LayoutDrawer::Draw(const std::list<std::optional<improc::DrawerVariant>>& context, improc::WorkerPool& worker_pool)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing layout using worker pool...");
+    return this->improc::PageDrawer::Draw(std::move(context),worker_pool);
+}
+
+/**
+ * @brief Draw layout in a given page image
+ * 
+ * @param page_image - page image to draw layout
+ * @param context - list of messages to be considered in layout
+ */
+void improc::LayoutDrawer::Draw(cv::Mat& page_image, const std::list<std::optional<improc::DrawerVariant>>& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing layout in page image...");
+    this->improc::PageDrawer::Draw(page_image,std::move(context));
+}
+
+/**
+ * @brief Draw layout in a page image obtained from a page buffer pool
+ * 
+ * @param page_buffer_pool - pool providing the page image
+ * @param context - list of messages to be considered in layout
+ * @return improc::PooledPage - pooled page exclusively owning the page image, given back to the pool when released
+ */
+improc::PooledPage improc::LayoutDrawer::Draw(improc::PageBufferPool& page_buffer_pool, const std::list<std::optional<improc::DrawerVariant>>& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing layout in pooled page...");
+    return this->improc::PageDrawer::Draw(page_buffer_pool,std::move(context));
+}
+
+/**
+ * @brief Draw several layouts using a worker pool with one worker per hardware thread
+ * 
+ * @param contexts - list of messages to be considered in each layout
+ * @return std::vector<cv::Mat> - page images with layout elements drawed, in the same order as the contexts
+ */
+std::vector<cv::Mat> improc::LayoutDrawer::DrawBatch(const std::vector<std::list<std::optional<improc::DrawerVariant>>>& contexts) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing batch of layouts...");
+    return this->improc::PageDrawer::DrawBatch(std::move(contexts));
+}
+
+/**
+ * @brief Draw several layouts using a worker pool
+ * 
+ * @param contexts - list of messages to be considered in each layout
+ * @param worker_pool - worker pool used to draw the layouts
+ * @return std::vector<cv::Mat> - page images with layout elements drawed, in the same order as the contexts
+ */
+std::vector<cv::Mat> improc::LayoutDrawer::DrawBatch(const std::vector<std::list<std::optional<improc::DrawerVariant>>>& contexts, improc::WorkerPool& worker_pool) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing batch of layouts...");
+    return this->improc::PageDrawer::DrawBatch(std::move(contexts),worker_pool);
+}
+
 /**
  * @brief Verify layout
  * 
@@ -184,8 +370,133 @@ bool improc::LayoutDrawer::Verify(const std::list<std::optional<improc::DrawerVa
  * @param context - list of messages to be considered in layout
  * @return bool - true if layout is correct, false otherwise.
  */
-bool improc::LayoutDrawer::Verify(const cv::Mat& page_image,const std::list<std::optional<improc::DrawerVariant>>& context)
+bool improc::LayoutDrawer::Verify(const cv::Mat& page_image,const std::list<std::optional<improc::DrawerVariant>>& context) const
 {
     IMPROC_DRAWER_LOGGER_TRACE("Verifying layout given as input...");
     return this->improc::PageDrawer::Verify(std::move(page_image),std::move(context));
 }
+
+/**
+ * @brief Draw layout in a given page image using a context with messages borrowed from the caller
+ * 
+ * @param page_image - page image to draw layout
+ * @param context - view of messages to be considered in layout
+ */
+void improc::LayoutDrawer::Draw(cv::Mat& page_image, const improc::DrawerContextView& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing layout in page image from context view...");
+    this->improc::PageDrawer::Draw(page_image,context);
+}
+
+/**
+ * @brief Draw layout in a page image obtained from a page buffer pool using a context with messages borrowed from the caller
+ * 
+ * @param page_buffer_pool - pool providing the page image
+ * @param context - view of messages to be considered in layout
+ * @return improc::PooledPage - pooled page exclusively owning the page image, given back to the pool when released
+ */
+improc::PooledPage improc::LayoutDrawer::Draw(improc::PageBufferPool& page_buffer_pool, const improc::DrawerContextView& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing layout in pooled page from context view...");
+    return this->improc::PageDrawer::Draw(page_buffer_pool,context);
+}
+
+/**
+ * @brief Verify a layout page image using a context with messages borrowed from the caller
+ * 
+ * @param page_image - page image to be verified
+ * @param context - view of messages to be considered in layout
+ * @return bool - true if layout is correct, false otherwise.
+ */
+bool improc::LayoutDrawer::Verify(const cv::Mat& page_image, const improc::DrawerContextView& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying layout page image from context view...");
+    return this->improc::PageDrawer::Verify(page_image,context);
+}
+
+/**
+ * @brief Verify last drawn layout using a worker pool
+ * 
+ * @param context - list of messages to be considered in layout
+ * @param worker_pool - worker pool used to verify the layout elements
+ * @param policy - verification policy, full report by default
+ * @return improc::VerificationReport - verification result and time of every layout element
+ */
+improc::VerificationReport improc::LayoutDrawer::Verify(const std::list<std::optional<improc::DrawerVariant>>& context, improc::WorkerPool& worker_pool, improc::VerificationPolicy policy) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying layout using worker pool...");
+    return this->improc::PageDrawer::Verify(std::move(context),worker_pool,std::move(policy));
+}
+
+/**
+ * @brief Verify a layout page image using a worker pool
+ * 
+ * @param page_image - page image to be verified
+ * @param context - list of messages to be considered in layout
+ * @param worker_pool - worker pool used to verify the layout elements
+ * @param policy - verification policy, full report by default
+ * @return improc::VerificationReport - verification result and time of every layout element
+ */
+improc::VerificationReport improc::LayoutDrawer::Verify(const cv::Mat& page_image, const std::list<std::optional<improc::DrawerVariant>>& context, improc::WorkerPool& worker_pool, improc::VerificationPolicy policy) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying layout page image using worker pool...");
+    return this->improc::PageDrawer::Verify(page_image,std::move(context),worker_pool,std::move(policy));
+}
+
+/**
+ * @brief Update the drawn layout with the messages of the slots that changed
+ * 
+ * @param slot_context - slots that changed with their messages
+ * @return cv::Mat - page image with layout elements drawed
+ */
+cv::Mat improc::LayoutDrawer::DrawSlots(const std::vector<std::pair<size_t,std::optional<improc::DrawerVariant>>>& slot_context)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing layout slots...");
+    return this->improc::PageDrawer::DrawSlots(slot_context);
+}
+
+/**
+ * @brief Update the drawn layout with the messages of the layout elements that changed, given by identifier
+ * 
+ * @param element_context - identifiers of layout elements that changed with their messages
+ * @return cv::Mat - page image with layout elements drawed
+ */
+cv::Mat improc::LayoutDrawer::DrawSlots(const std::unordered_map<std::string,std::optional<improc::DrawerVariant>>& element_context)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing layout elements by identifier...");
+    return this->improc::PageDrawer::DrawSlots(element_context);
+}
+
+/**
+ * @brief Obtain slot of a layout element, the index of its message in the context
+ * 
+ * @param element_id - layout element identifier, prefixed with the page drawer identifier when defined
+ * @return size_t - slot of layout element
+ */
+size_t improc::LayoutDrawer::GetElementSlot(const std::string& element_id) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining slot of layout element...");
+    return this->improc::PageDrawer::GetElementSlot(element_id);
+}
+
+/**
+ * @brief Reset the number of skipped draws of every layout element
+ */
+improc::LayoutDrawer& improc::LayoutDrawer::ResetSkipCounters()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Resetting layout skip counters...");
+    this->improc::PageDrawer::ResetSkipCounters();
+    return (*this);
+}
+
+/**
+ * @brief Set incremental draw mode of layout
+ * 
+ * @param incremental_draw - true to skip layout elements whose message did not change since the last draw
+ */
+improc::LayoutDrawer& improc::LayoutDrawer::set_incremental_draw(bool incremental_draw)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Setting layout incremental draw...");
+    this->improc::PageDrawer::set_incremental_draw(incremental_draw);
+    return (*this);
+}
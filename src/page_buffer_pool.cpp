@@ -0,0 +1,133 @@
+#include <improc/drawer/engine/page_buffer_pool.hpp>
+
+#include <algorithm>
+
+/**
+ * @brief Construct a new empty improc::PooledPage object
+ */
+improc::PooledPage::PooledPage() : page_image_(cv::Mat())
+                                 , buffers_(std::weak_ptr<Buffers>()) {};
+
+/**
+ * @brief Construct a new improc::PooledPage object
+ *
+ * @param page_image - page image owned by the pooled page
+ * @param buffers - idle buffers of the page buffer pool
+ */
+improc::PooledPage::PooledPage(cv::Mat&& page_image, const std::shared_ptr<Buffers>& buffers) : page_image_(std::move(page_image))
+                                                                                             , buffers_(buffers) {};
+
+/**
+ * @brief Construct a new improc::PooledPage object by moving another pooled page
+ *
+ * @param that - pooled page to move
+ */
+improc::PooledPage::PooledPage(improc::PooledPage&& that) : page_image_(std::move(that.page_image_))
+                                                          , buffers_(std::move(that.buffers_))
+{
+    that.page_image_ = cv::Mat();
+    that.buffers_.reset();
+}
+
+/**
+ * @brief Move another pooled page into this pooled page, releasing the current page image
+ *
+ * @param that - pooled page to move
+ */
+improc::PooledPage& improc::PooledPage::operator=(improc::PooledPage&& that)
+{
+    if (this != &that)
+    {
+        this->Release();
+        this->page_image_ = std::move(that.page_image_);
+        this->buffers_    = std::move(that.buffers_);
+        that.page_image_  = cv::Mat();
+        that.buffers_.reset();
+    }
+    return (*this);
+}
+
+/**
+ * @brief Destroy the improc::PooledPage object, giving the page image back to the pool
+ */
+improc::PooledPage::~PooledPage()
+{
+    this->Release();
+}
+
+/**
+ * @brief Give the page image back to the pool.
+ * The page image is discarded instead if the pool no longer exists, the pool is full, or other matrix
+ * headers still reference the page image data. The reference counter is read atomically, since headers 
+ * may be released concurrently by other threads.
+ */
+void improc::PooledPage::Release()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Releasing pooled page...");
+    std::shared_ptr<Buffers> buffers = this->buffers_.lock();
+    if (buffers != nullptr && this->page_image_.u != nullptr && CV_XADD(&this->page_image_.u->refcount,0) == 1)
+    {
+        std::lock_guard<std::mutex> lock {buffers->mutex};
+        if (buffers->idle.size() < buffers->max_idle)
+        {
+            buffers->idle.push_back(std::move(this->page_image_));
+        }
+    }
+    this->page_image_ = cv::Mat();
+    this->buffers_.reset();
+}
+
+/**
+ * @brief Construct a new improc::PageBufferPool object with the default limit of idle buffers
+ */
+improc::PageBufferPool::PageBufferPool() : improc::PageBufferPool(improc::PageBufferPool::kDefaultMaxIdleBuffers) {};
+
+/**
+ * @brief Construct a new improc::PageBufferPool object
+ *
+ * @param max_idle_buffers - maximum number of idle page buffers kept for reuse
+ */
+improc::PageBufferPool::PageBufferPool(size_t max_idle_buffers) : buffers_(std::make_shared<improc::PooledPage::Buffers>())
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Creating page buffer pool...");
+    this->buffers_->max_idle = max_idle_buffers;
+}
+
+/**
+ * @brief Obtain a page image from the pool, allocating it only if no idle buffer has the requested size and type
+ *
+ * @param page_size - size of page image
+ * @param data_type - data type of page image
+ * @return improc::PooledPage - pooled page with uninitialized page image
+ */
+improc::PooledPage improc::PageBufferPool::Acquire(const cv::Size& page_size, int data_type)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Acquiring page buffer...");
+    cv::Mat page_image {};
+    {
+        std::lock_guard<std::mutex> lock {this->buffers_->mutex};
+        auto idle_iter = std::find_if   ( this->buffers_->idle.begin(),this->buffers_->idle.end()
+                                        , [&page_size,data_type] (const cv::Mat& buffer) {return buffer.size() == page_size && buffer.type() == data_type;} );
+        if (idle_iter != this->buffers_->idle.end())
+        {
+            page_image = std::move(*idle_iter);
+            this->buffers_->idle.erase(idle_iter);
+        }
+    }
+
+    if (page_image.empty() == true)
+    {
+        IMPROC_DRAWER_LOGGER_DEBUG("Allocating page buffer with width = {}, height = {}",page_size.width,page_size.height);
+        page_image = cv::Mat(page_size,data_type);
+    }
+    return improc::PooledPage(std::move(page_image),this->buffers_);
+}
+
+/**
+ * @brief Obtain number of idle page buffers in pool
+ */
+size_t improc::PageBufferPool::get_number_idle_buffers() const
+{
+    std::lock_guard<std::mutex> lock {this->buffers_->mutex};
+    return this->buffers_->idle.size();
+}
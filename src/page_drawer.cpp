@@ -3,9 +3,16 @@
 /**
  * @brief Construct a new improc::PageDrawer object
  */
-improc::PageDrawer::PageDrawer(): elements_(std::list<improc::PageElementDrawer>()) 
+improc::PageDrawer::PageDrawer(): elements_(std::vector<improc::PageElementDrawer>()) 
+                                , number_elements_(0)
                                 , page_size_(cv::Size())
-                                , page_image_(cv::Mat()) {};
+                                , page_image_(cv::Mat())
+                                , render_plan_(std::shared_ptr<const improc::RenderPlan>())
+                                , element_slots_(std::unordered_map<std::string,size_t>())
+                                , slot_messages_(std::vector<std::optional<improc::DrawerVariant>>())
+                                , has_slot_messages_(false)
+                                , incremental_draw_(false)
+                                , skip_counters_(std::vector<size_t>()) {};
 
 /**
  * @brief Construct a new improc::PageDrawer object
@@ -19,7 +26,10 @@ improc::PageDrawer::PageDrawer(const improc::DrawerFactory& factory, const Json:
 }
 
 /**
- * @brief Load configuration for a improc::PageDrawer object
+ * @brief Load configuration for a improc::PageDrawer object. 
+ * The page configuration can define render caches per drawer type, shared by the page elements of that drawer 
+ * type without a render cache of their own. Page elements with an identifier are given a slot, the index of 
+ * their message in the context.
  * 
  * @param factory - factory with base drawer types
  * @param page_drawer_json - configuration json for page drawer
@@ -29,6 +39,7 @@ improc::PageDrawer& improc::PageDrawer::Load(const improc::DrawerFactory& factor
     IMPROC_DRAWER_LOGGER_TRACE("Creating page drawer...");
     static const std::string kPageSizeKey = "page-size";
     static const std::string kElementsKey = "elements";
+    static const std::string kCacheKey    = "render-cache";
     if (page_drawer_json.isMember(kPageSizeKey) == false)
     {
         std::string error_message = fmt::format("Key {} is missing from page drawer json",kPageSizeKey);
@@ -36,46 +47,280 @@ improc::PageDrawer& improc::PageDrawer::Load(const improc::DrawerFactory& factor
         throw improc::json_error(std::move(error_message));
     }
     this->page_size_ = improc::json::ReadPositiveSize<cv::Size>(page_drawer_json[kPageSizeKey]);
+    this->ClearPageElements();
 
     if (page_drawer_json.isMember(kElementsKey) == true)
     {
-        this->elements_.clear();
+        std::vector<improc::PageElementDrawer> page_elements {};
         if (page_drawer_json[kElementsKey].isArray() == true)
         {
-            this->elements_ = std::list<improc::PageElementDrawer>(page_drawer_json[kElementsKey].size());
-            std::transform  ( page_drawer_json[kElementsKey].begin(), page_drawer_json[kElementsKey].end(), this->elements_.begin()
+            page_elements.reserve(page_drawer_json[kElementsKey].size());
+            std::transform  ( page_drawer_json[kElementsKey].begin(), page_drawer_json[kElementsKey].end(), std::back_inserter(page_elements)
                             , [this,&factory] (const Json::Value& json_elem) -> improc::PageElementDrawer {return improc::PageElementDrawer(factory,std::move(json_elem),this->page_size_);});
         }
         else
         {
-            this->elements_.push_back(improc::PageElementDrawer(std::move(factory),page_drawer_json[kElementsKey],this->page_size_));
+            page_elements.push_back(improc::PageElementDrawer(std::move(factory),page_drawer_json[kElementsKey],this->page_size_));
+        }
+        if (page_drawer_json.isMember(kCacheKey) == true)
+        {
+            improc::PageDrawer::AssignRenderCaches(page_drawer_json[kCacheKey],page_elements);
+        }
+        this->AppendPageElements(std::move(page_elements));
+    }
+    return (*this);
+}
+
+/**
+ * @brief Create render caches per drawer type and assign them to the page elements of that drawer type 
+ * without a render cache of their own
+ * 
+ * @param render_cache_json - configuration json for render caches, each with a drawer type
+ * @param page_elements - page elements of page drawer
+ */
+void improc::PageDrawer::AssignRenderCaches(const Json::Value& render_cache_json, std::vector<improc::PageElementDrawer>& page_elements)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Assigning render caches...");
+    static const std::string kDrawerType = "drawer-type";
+    std::vector<Json::Value> render_caches_json {};
+    if (render_cache_json.isArray() == true)
+    {
+        render_caches_json.assign(render_cache_json.begin(),render_cache_json.end());
+    }
+    else
+    {
+        render_caches_json.push_back(render_cache_json);
+    }
+
+    for (const Json::Value& cache_json : render_caches_json)
+    {
+        if (cache_json.isMember(kDrawerType) == false)
+        {
+            std::string error_message = fmt::format("Key {} is missing from page render cache json",kDrawerType);
+            IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+            throw improc::json_error(std::move(error_message));
+        }
+        std::string                          drawer_type  = improc::json::ReadElement<std::string>(cache_json[kDrawerType]);
+        std::shared_ptr<improc::RenderCache> render_cache = std::make_shared<improc::RenderCache>(cache_json);
+        for (improc::PageElementDrawer& elem : page_elements)
+        {
+            if (elem.get_element_drawer().get_drawer_type() == drawer_type && elem.get_element_drawer().get_render_cache() == nullptr)
+            {
+                elem.set_render_cache(render_cache);
+            }
         }
     }
+}
+
+/**
+ * @brief Remove page elements and allocation from page drawer
+ */
+improc::PageDrawer& improc::PageDrawer::ClearPageElements()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Clearing page elements...");
+    this->elements_.clear();
+    this->number_elements_ = 0;
+    this->element_slots_.clear();
+    this->slot_messages_.clear();
+    this->has_slot_messages_ = false;
+    this->skip_counters_.clear();
+    this->page_image_ = cv::Mat();
+    this->render_plan_.reset();
     return (*this);
 }
 
 /**
- * @brief Allocate and initialize page image
+ * @brief Move page elements to the end of the page drawer elements
+ * 
+ * @param page_elements - page elements to append
+ */
+improc::PageDrawer& improc::PageDrawer::AppendPageElements(std::vector<improc::PageElementDrawer>&& page_elements)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Appending {} page elements...",page_elements.size());
+    for (size_t elem_idx = 0; elem_idx < page_elements.size(); elem_idx++)
+    {
+        const std::string& element_id = page_elements[elem_idx].get_element_id();
+        if (element_id.empty() == false && this->element_slots_.emplace(element_id,this->elements_.size() + elem_idx).second == false)
+        {
+            std::string error_message = fmt::format("Page element identifier {} should be unique in page",element_id);
+            IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+    }
+    this->elements_.reserve(this->elements_.size() + page_elements.size());
+    std::move(page_elements.begin(),page_elements.end(),std::back_inserter(this->elements_));
+    this->number_elements_ = this->elements_.size();
+    page_elements.clear();
+    return (*this);
+}
+
+/**
+ * @brief Append slots of page elements created only when allocating, counting them as page elements. 
+ * The slots are given relative to the first of the counted page elements.
+ * 
+ * @param element_slots - slots of the page elements with identifier
+ * @param number_elements - number of page elements to count
+ */
+improc::PageDrawer& improc::PageDrawer::AppendElementSlots(const std::unordered_map<std::string,size_t>& element_slots, size_t number_elements)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Appending slots of {} page elements...",number_elements);
+    for (const std::pair<const std::string,size_t>& element_slot : element_slots)
+    {
+        if (this->element_slots_.emplace(element_slot.first,this->number_elements_ + element_slot.second).second == false)
+        {
+            std::string error_message = fmt::format("Page element identifier {} should be unique in page",element_slot.first);
+            IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+    }
+    this->number_elements_ += number_elements;
+    return (*this);
+}
+
+/**
+ * @brief Move page elements out of the page drawer, leaving it without page elements nor allocation
+ * 
+ * @return std::vector<improc::PageElementDrawer> - page elements of page drawer
+ */
+std::vector<improc::PageElementDrawer> improc::PageDrawer::ExtractPageElements()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Extracting page elements...");
+    std::vector<improc::PageElementDrawer> page_elements = std::move(this->elements_);
+    this->ClearPageElements();
+    return page_elements;
+}
+
+/**
+ * @brief Allocate and initialize page image. 
+ * Dynamic page elements are grouped in draw levels: page elements in the same draw level have disjoint element 
+ * boxes and can be drawn concurrently, while overlapping page elements are placed in successive draw levels.
  */
 improc::PageDrawer& improc::PageDrawer::Allocate()
 {
     IMPROC_DRAWER_LOGGER_TRACE("Allocating page...");
+    this->render_plan_.reset();
     this->page_image_ = cv::Mat(this->page_size_.height,this->page_size_.width,improc::BaseDrawer::kImageDataType,improc::BaseDrawer::kWhiteValue);
-    std::for_each   ( this->elements_.begin(),this->elements_.end()
-                    , [this] (improc::PageElementDrawer& elem) 
-                        {
-                            elem.Allocate();
-                            if (elem.is_element_static() == true)
-                            {
-                                elem.Draw(this->page_image_);
-                            }
-                        } 
-                    );
+    for (improc::PageElementDrawer& elem : this->elements_)
+    {
+        elem.Allocate();
+        if (elem.is_element_static() == true)
+        {
+            elem.Draw(this->page_image_);
+        }
+    }
+    return this->CompileRenderPlan();
+}
+
+/**
+ * @brief Allocate and initialize page image using a render plan cache. 
+ * If the cache holds an allocation of this page, element boxes and page image are restored from the cache 
+ * without drawing any page element. Otherwise, the page is allocated and its allocation written to the cache.
+ * 
+ * @param render_plan_cache - render plan cache of page
+ */
+improc::PageDrawer& improc::PageDrawer::Allocate(const improc::RenderPlanCache& render_plan_cache)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Allocating page using render plan cache...");
+    if (this->AllocateFromCache(render_plan_cache) == false)
+    {
+        this->Allocate();
+        render_plan_cache.Write(*this->render_plan_);
+    }
+    return (*this);
+}
+
+/**
+ * @brief Restore page allocation from a render plan cache
+ * 
+ * @param render_plan_cache - render plan cache of page
+ * @return bool - true if page allocation was restored, false if the cache has no allocation matching the page elements
+ */
+bool improc::PageDrawer::AllocateFromCache(const improc::RenderPlanCache& render_plan_cache)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Restoring page allocation from render plan cache...");
+    std::optional<improc::RenderPlanCache::CachedAllocation> cached_allocation = render_plan_cache.Read();
+    if (  cached_allocation.has_value() == false
+       || cached_allocation->page_size != this->page_size_
+       || cached_allocation->element_boxes.size() != this->elements_.size() )
+    {
+        return false;
+    }
+    for (size_t elem_idx = 0; elem_idx < this->elements_.size(); elem_idx++)
+    {
+        const cv::Rect& element_box = cached_allocation->element_boxes[elem_idx];
+        if (  cached_allocation->static_elements[elem_idx] != this->elements_[elem_idx].is_element_static()
+           || element_box.tl() != this->elements_[elem_idx].get_top_left() )
+        {
+            IMPROC_DRAWER_LOGGER_DEBUG("Render plan cache does not match page element {}",elem_idx);
+            return false;
+        }
+    }
+
+    this->render_plan_.reset();
+    for (size_t elem_idx = 0; elem_idx < this->elements_.size(); elem_idx++)
+    {
+        this->elements_[elem_idx].Allocate(cached_allocation->element_boxes[elem_idx],cached_allocation->element_scales[elem_idx]);
+    }
+    this->page_image_ = std::move(cached_allocation->background);
+    this->CompileRenderPlan();
+    return true;
+}
+
+/**
+ * @brief Compile the allocated page elements and page image in a render plan
+ */
+improc::PageDrawer& improc::PageDrawer::CompileRenderPlan()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Compiling page render plan...");
+    this->render_plan_ = std::make_shared<const improc::RenderPlan>(this->page_size_,this->page_image_,this->elements_);
+    this->slot_messages_.assign(this->elements_.size(),std::optional<improc::DrawerVariant>());
+    this->has_slot_messages_ = false;
+    this->skip_counters_.assign(this->elements_.size(),0);
     return (*this);
 }
 
 /**
- * @brief Draw page
+ * @brief Validate if the page drawer can draw or verify a context
+ * 
+ * @param context - list of messages to be considered in page
+ * @return bool - true if page drawer has a render plan, false if page drawer has no page elements and is not allocated
+ */
+bool improc::PageDrawer::HasRenderPlan(const std::list<std::optional<improc::DrawerVariant>>& context) const
+{
+    if (this->number_elements_ != context.size())
+    {
+        std::string error_message = fmt::format ( "Number of elements in context ({}) different than the number of elements in page ({})"
+                                                , context.size(), this->number_elements_ );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (this->render_plan_ == nullptr && this->number_elements_ > 0)
+    {
+        std::string error_message = "Please allocate page drawer before drawing or verifying page elements";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    return this->render_plan_ != nullptr;
+}
+
+/**
+ * @brief Obtain indexes of dynamic page elements grouped by draw level, empty if page drawer is not allocated
+ */
+std::vector<std::vector<size_t>> improc::PageDrawer::get_draw_levels() const
+{
+    if (this->render_plan_ == nullptr)
+    {
+        return std::vector<std::vector<size_t>>();
+    }
+    return this->render_plan_->get_draw_levels();
+}
+
+/**
+ * @brief Draw page. 
+ * In incremental draw mode, the last message drawn in each slot is kept and only the page elements whose message 
+ * changed since the last draw are drawn again, counting the skipped draws per page element. Otherwise, the 
+ * messages of the slots are not recorded and the page should be drawn again in incremental draw mode before 
+ * drawing page slots.
  * 
  * @param context - list of messages to be considered in page
  * @return cv::Mat - page image with page elements drawed
@@ -83,27 +328,184 @@ improc::PageDrawer& improc::PageDrawer::Allocate()
 cv::Mat improc::PageDrawer::Draw(const std::list<std::optional<improc::DrawerVariant>>& context)
 {
     IMPROC_DRAWER_LOGGER_TRACE("Drawing page...");
-    if (this->elements_.size() != context.size())
+    if (this->HasRenderPlan(context) == true)
     {
-        std::string error_message = fmt::format ( "Number of elements in context ({}) different than the number of elements in page ({})"
-                                                , context.size(), this->elements_.size() );
+        if (this->incremental_draw_ == true)
+        {
+            this->DrawChangedElements(std::move(context));
+        }
+        else
+        {
+            this->render_plan_->DrawElements(this->page_image_,std::move(context));
+            this->InvalidateSlotMessages();
+        }
+    }
+    return this->page_image_;
+}
+
+/**
+ * @brief Draw the dynamic page elements whose message differs from the last message drawn. 
+ * Later page elements overlapping a redrawn page element are also drawn again to keep the painting order.
+ * 
+ * @param context - list of messages to be considered in page
+ */
+improc::PageDrawer& improc::PageDrawer::DrawChangedElements(const std::list<std::optional<improc::DrawerVariant>>& context)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing changed page elements...");
+    std::vector<size_t> changed_slots {};
+    std::list<std::optional<improc::DrawerVariant>>::const_iterator message_iter = context.begin();
+    for (size_t elem_idx = 0; elem_idx < this->elements_.size(); elem_idx++, message_iter++)
+    {
+        if (this->elements_[elem_idx].is_element_static() == true)
+        {
+            continue;
+        }
+        if (this->has_slot_messages_ == true && this->slot_messages_[elem_idx] == *message_iter)
+        {
+            this->skip_counters_[elem_idx]++;
+            continue;
+        }
+        this->slot_messages_[elem_idx] = *message_iter;
+        changed_slots.push_back(elem_idx);
+    }
+    IMPROC_DRAWER_LOGGER_DEBUG("Drawing {} changed page elements",changed_slots.size());
+    this->has_slot_messages_ = false;
+    this->render_plan_->DrawSlots(this->page_image_,this->slot_messages_,changed_slots);
+    this->has_slot_messages_ = true;
+    return (*this);
+}
+
+/**
+ * @brief Forget the last messages drawn, so the next incremental draw draws every page element
+ */
+improc::PageDrawer& improc::PageDrawer::InvalidateSlotMessages()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Invalidating slot messages...");
+    this->has_slot_messages_ = false;
+    return (*this);
+}
+
+/**
+ * @brief Set incremental draw mode. 
+ * Changing the mode forgets the last messages drawn, so the next draw draws every page element. The skipped 
+ * draws keep being counted until the skip counters are reset.
+ * 
+ * @param incremental_draw - true to skip page elements whose message did not change since the last draw
+ */
+improc::PageDrawer& improc::PageDrawer::set_incremental_draw(bool incremental_draw)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Setting incremental draw to {}...",incremental_draw);
+    this->incremental_draw_ = incremental_draw;
+    return this->InvalidateSlotMessages();
+}
+
+/**
+ * @brief Reset the number of skipped draws of every page element
+ */
+improc::PageDrawer& improc::PageDrawer::ResetSkipCounters()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Resetting skip counters...");
+    std::fill(this->skip_counters_.begin(),this->skip_counters_.end(),0);
+    return (*this);
+}
+
+/**
+ * @brief Draw page using a worker pool to draw page elements concurrently. 
+ * Page elements in the same draw level are drawn concurrently and draw levels are drawn in sequence. 
+ * The messages of the slots are not recorded, so the next incremental draw draws every page element.
+ * 
+ * @param context - list of messages to be considered in page
+ * @param worker_pool - worker pool used to draw the page elements
+ * @return cv::Mat - page image with page elements drawed
+ */
+cv::Mat improc::PageDrawer::Draw(const std::list<std::optional<improc::DrawerVariant>>& context, improc::WorkerPool& worker_pool)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing page using worker pool...");
+    if (this->HasRenderPlan(context) == false)
+    {
+        std::string error_message = "Please allocate page drawer before drawing page elements using worker pool";
         IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
-        throw improc::value_error(std::move(error_message));
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    this->render_plan_->DrawElements(this->page_image_,std::move(context),worker_pool);
+    this->InvalidateSlotMessages();
+    return this->page_image_;
+}
+
+/**
+ * @brief Draw page in a given page image. 
+ * The page image is initialized from the render plan background, reusing its data whenever it already 
+ * has the page size, so the page drawer and the page image do not share data.
+ * 
+ * @param page_image - page image to draw page
+ * @param context - list of messages to be considered in page
+ */
+void improc::PageDrawer::Draw(cv::Mat& page_image, const std::list<std::optional<improc::DrawerVariant>>& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing page in page image...");
+    if (this->render_plan_ == nullptr)
+    {
+        std::string error_message = "Please allocate page drawer before drawing in a page image";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
     }
+    this->render_plan_->Draw(page_image,std::move(context));
+}
 
-    std::vector<bool> dummy = std::vector<bool>(this->elements_.size());
-    // TODO: Implement with foreach whenever the second iterator is available on STL
-    std::transform  ( this->elements_.begin(),this->elements_.end(),context.begin(),dummy.begin()
-                    , [this] (const improc::PageElementDrawer& elem, const std::optional<improc::DrawerVariant>& message) -> bool
+/**
+ * @brief Draw page in a page image obtained from a page buffer pool
+ * 
+ * @param page_buffer_pool - pool providing the page image
+ * @param context - list of messages to be considered in page
+ * @return improc::PooledPage - pooled page exclusively owning the page image, given back to the pool when released
+ */
+improc::PooledPage improc::PageDrawer::Draw(improc::PageBufferPool& page_buffer_pool, const std::list<std::optional<improc::DrawerVariant>>& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing page in pooled page...");
+    improc::PooledPage pooled_page = page_buffer_pool.Acquire(this->page_size_,improc::BaseDrawer::kImageDataType);
+    {
+        cv::Mat page_image = pooled_page.get_page_image();
+        this->Draw(page_image,std::move(context));
+    }
+    return pooled_page;
+}
+
+/**
+ * @brief Draw several pages using the default worker pool, shared between calls
+ * 
+ * @param contexts - list of messages to be considered in each page
+ * @return std::vector<cv::Mat> - page images with page elements drawed, in the same order as the contexts
+ */
+std::vector<cv::Mat> improc::PageDrawer::DrawBatch(const std::vector<std::list<std::optional<improc::DrawerVariant>>>& contexts) const
+{
+    return this->DrawBatch(std::move(contexts),improc::WorkerPool::GetDefault());
+}
+
+/**
+ * @brief Draw several pages using a worker pool
+ * 
+ * Each page is drawn in its own image, initialized from the render plan background, so the page images 
+ * returned do not share data with each other nor with the page drawer. Base drawers are called 
+ * concurrently from the worker pool threads.
+ * 
+ * @param contexts - list of messages to be considered in each page
+ * @param worker_pool - worker pool used to draw the pages
+ * @return std::vector<cv::Mat> - page images with page elements drawed, in the same order as the contexts
+ */
+std::vector<cv::Mat> improc::PageDrawer::DrawBatch(const std::vector<std::list<std::optional<improc::DrawerVariant>>>& contexts, improc::WorkerPool& worker_pool) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing batch of {} pages...",contexts.size());
+    std::vector<cv::Mat> page_images = std::vector<cv::Mat>(contexts.size());
+    worker_pool.Run ( contexts.size()
+                    , [this,&contexts,&page_images] (size_t page_idx)
                         {
-                            if (elem.is_element_static() == false)
+                            if (this->HasRenderPlan(contexts[page_idx]) == true)
                             {
-                                elem.Draw(this->page_image_,std::move(message));
+                                this->render_plan_->Draw(page_images[page_idx],contexts[page_idx]);
                             }
-                            return true;
-                        } 
+                        }
                     );
-    return this->page_image_;
+    return page_images;
 }
 
 /**
@@ -115,61 +517,227 @@ cv::Mat improc::PageDrawer::Draw(const std::list<std::optional<improc::DrawerVar
 bool improc::PageDrawer::Verify(const std::list<std::optional<improc::DrawerVariant>>& context)
 {
     IMPROC_DRAWER_LOGGER_TRACE("Verifying page...");
-    if (this->elements_.size() != context.size())
+    if (this->HasRenderPlan(context) == false)
     {
-        std::string error_message = fmt::format ( "Number of elements in context ({}) different than the number of elements in page ({})"
-                                                , context.size(), this->elements_.size() );
-        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
-        throw improc::value_error(std::move(error_message));
+        return true;
     }
-
-    std::vector<bool> are_valid = std::vector<bool>(this->elements_.size());
-    // TODO: Implement with foreach whenever the second iterator is available on STL
-    std::transform  ( this->elements_.begin(),this->elements_.end(),context.begin(),are_valid.begin()
-                    , [this] (const improc::PageElementDrawer& elem, const std::optional<improc::DrawerVariant>& message) -> bool
-                        {
-                            return elem.Verify(this->page_image_,std::move(message));
-                        } 
-                    );
-    return std::all_of(are_valid.begin(),are_valid.end(),[] (bool is_valid) {return is_valid;});
+    return this->render_plan_->Verify(this->page_image_,std::move(context));
 }
 
 /**
- * @brief Verify page
+ * @brief Verify page image without modifying the page drawer.
+ * Only the given page image and the render plan are read, so page images can be verified while other threads 
+ * draw with the same page drawer. The page image should have the page size, even if the page has no page elements.
  * 
  * @param page_image - page image to be verified
  * @param context - list of messages to be considered in page
  * @return bool - true if page is correct, false otherwise.
  */
-bool improc::PageDrawer::Verify(const cv::Mat& page_image,const std::list<std::optional<improc::DrawerVariant>>& context)
+bool improc::PageDrawer::Verify(const cv::Mat& page_image,const std::list<std::optional<improc::DrawerVariant>>& context) const
 {
     IMPROC_DRAWER_LOGGER_TRACE("Verifying page given as input...");
-    return this->set_page_image(std::move(page_image)).Verify(std::move(context));
+    bool has_render_plan = this->HasRenderPlan(context);
+    this->ValidatePageImage(page_image);
+    if (has_render_plan == false)
+    {
+        return true;
+    }
+    return this->render_plan_->Verify(page_image,std::move(context));
 }
 
 /**
- * @brief Validate and set page image
+ * @brief Draw page in a given page image using a context with messages borrowed from the caller
  * 
- * @param page_image - page image data
+ * @param page_image - page image to draw page
+ * @param context - view of messages to be considered in page
  */
-improc::PageDrawer& improc::PageDrawer::set_page_image(const cv::Mat& page_image)
+void improc::PageDrawer::Draw(cv::Mat& page_image, const improc::DrawerContextView& context) const
 {
-    IMPROC_DRAWER_LOGGER_TRACE("Setting page image...");
-    if (this->page_image_.empty() == true)
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing page in page image from context view...");
+    if (this->render_plan_ == nullptr)
     {
-        std::string error_message = "Please allocate page drawer before modifying page image";
+        std::string error_message = "Please allocate page drawer before drawing in a page image";
         IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
         throw improc::processing_flow_error(std::move(error_message));
     }
+    this->render_plan_->Draw(page_image,context);
+}
 
-    if (this->page_image_.size() != page_image.size())
+/**
+ * @brief Draw page in a page image obtained from a page buffer pool using a context with messages borrowed from the caller
+ * 
+ * @param page_buffer_pool - pool providing the page image
+ * @param context - view of messages to be considered in page
+ * @return improc::PooledPage - pooled page exclusively owning the page image, given back to the pool when released
+ */
+improc::PooledPage improc::PageDrawer::Draw(improc::PageBufferPool& page_buffer_pool, const improc::DrawerContextView& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing page in pooled page from context view...");
+    improc::PooledPage pooled_page = page_buffer_pool.Acquire(this->page_size_,improc::BaseDrawer::kImageDataType);
     {
-        std::string error_message = fmt::format ( "Page image (w={},h={}) should have the same size of allocated page image (w={},h={})"
-                                                , page_image.size().width, page_image.size().height
-                                                , this->page_image_.size().width, this->page_image_.size().height );
+        cv::Mat page_image = pooled_page.get_page_image();
+        this->Draw(page_image,context);
+    }
+    return pooled_page;
+}
+
+/**
+ * @brief Verify a page image using a context with messages borrowed from the caller
+ * 
+ * @param page_image - page image to be verified
+ * @param context - view of messages to be considered in page
+ * @return bool - true if page is correct, false otherwise.
+ */
+bool improc::PageDrawer::Verify(const cv::Mat& page_image, const improc::DrawerContextView& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying page image from context view...");
+    if (this->render_plan_ == nullptr)
+    {
+        std::string error_message = "Please allocate page drawer before verifying a page image";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    this->ValidatePageImage(page_image);
+    return this->render_plan_->Verify(page_image,context);
+}
+
+/**
+ * @brief Verify last drawn page using a worker pool
+ * 
+ * @param context - list of messages to be considered in page
+ * @param worker_pool - worker pool used to verify the page elements
+ * @param policy - verification policy, full report by default
+ * @return improc::VerificationReport - verification result and time of every page element
+ */
+improc::VerificationReport improc::PageDrawer::Verify(const std::list<std::optional<improc::DrawerVariant>>& context, improc::WorkerPool& worker_pool, improc::VerificationPolicy policy) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying page using worker pool...");
+    return this->Verify(this->page_image_,std::move(context),worker_pool,std::move(policy));
+}
+
+/**
+ * @brief Verify a page image using a worker pool.
+ * Page elements are verified concurrently. With the fail fast policy, the remaining page elements are skipped 
+ * once a page element fails verification.
+ * 
+ * @param page_image - page image to be verified
+ * @param context - list of messages to be considered in page
+ * @param worker_pool - worker pool used to verify the page elements
+ * @param policy - verification policy, full report by default
+ * @return improc::VerificationReport - verification result and time of every page element
+ */
+improc::VerificationReport improc::PageDrawer::Verify(const cv::Mat& page_image, const std::list<std::optional<improc::DrawerVariant>>& context, improc::WorkerPool& worker_pool, improc::VerificationPolicy policy) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying page image using worker pool...");
+    bool has_render_plan = this->HasRenderPlan(context);
+    this->ValidatePageImage(page_image);
+    if (has_render_plan == false)
+    {
+        return improc::VerificationReport();
+    }
+    return this->render_plan_->Verify(page_image,std::move(context),worker_pool,std::move(policy));
+}
+
+/**
+ * @brief Obtain slot of a page element, the index of its message in the context
+ * 
+ * @param element_id - page element identifier
+ * @return size_t - slot of page element
+ */
+size_t improc::PageDrawer::GetElementSlot(const std::string& element_id) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining slot of page element {}...",element_id);
+    std::unordered_map<std::string,size_t>::const_iterator slot_iter = this->element_slots_.find(element_id);
+    if (slot_iter == this->element_slots_.end())
+    {
+        std::string error_message = fmt::format("Page element identifier {} not found in page",element_id);
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    return slot_iter->second;
+}
+
+/**
+ * @brief Update the drawn page with the messages of the slots that changed. 
+ * Only the changed page elements, and the later page elements overlapping them, are drawn again. The other 
+ * slots keep the messages of the previous incremental draw or slot update, so the page should be drawn in 
+ * incremental draw mode first, and again whenever a slot update throws. The const draw methods draw other 
+ * page images, so they keep the recorded messages.
+ * 
+ * @param slot_context - slots that changed with their messages
+ * @return cv::Mat - page image with page elements drawed
+ */
+cv::Mat improc::PageDrawer::DrawSlots(const std::vector<std::pair<size_t,std::optional<improc::DrawerVariant>>>& slot_context)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing {} page slots...",slot_context.size());
+    if (this->render_plan_ == nullptr)
+    {
+        std::string error_message = "Please allocate page drawer before drawing page slots";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    if (this->has_slot_messages_ == false)
+    {
+        std::string error_message = "Please draw page in incremental draw mode before drawing page slots";
         IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+
+    std::vector<size_t> slots {};
+    slots.reserve(slot_context.size());
+    for (const std::pair<size_t,std::optional<improc::DrawerVariant>>& slot_message : slot_context)
+    {
+        if (slot_message.first >= this->elements_.size() || this->elements_[slot_message.first].is_element_static() == true)
+        {
+            std::string error_message = fmt::format("Slot {} should correspond to a dynamic page element",slot_message.first);
+            IMPROC_DRAWER_LOGGER_ERROR("ERROR_03: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+        slots.push_back(slot_message.first);
+    }
+    for (const std::pair<size_t,std::optional<improc::DrawerVariant>>& slot_message : slot_context)
+    {
+        this->slot_messages_[slot_message.first] = slot_message.second;
+    }
+    this->has_slot_messages_ = false;
+    this->render_plan_->DrawSlots(this->page_image_,this->slot_messages_,slots);
+    this->has_slot_messages_ = true;
+    return this->page_image_;
+}
+
+/**
+ * @brief Update the drawn page with the messages of the page elements that changed, given by identifier
+ * 
+ * @param element_context - identifiers of page elements that changed with their messages
+ * @return cv::Mat - page image with page elements drawed
+ */
+cv::Mat improc::PageDrawer::DrawSlots(const std::unordered_map<std::string,std::optional<improc::DrawerVariant>>& element_context)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing {} page elements by identifier...",element_context.size());
+    std::vector<std::pair<size_t,std::optional<improc::DrawerVariant>>> slot_context {};
+    slot_context.reserve(element_context.size());
+    std::transform  ( element_context.begin(),element_context.end(),std::back_inserter(slot_context)
+                    , [this] (const std::pair<const std::string,std::optional<improc::DrawerVariant>>& element_message) 
+                        {
+                            return std::make_pair(this->GetElementSlot(element_message.first),element_message.second);
+                        } 
+                    );
+    return this->DrawSlots(slot_context);
+}
+
+/**
+ * @brief Validate if page image has the page size
+ * 
+ * @param page_image - page image to be verified
+ */
+void improc::PageDrawer::ValidatePageImage(const cv::Mat& page_image) const
+{
+    if (page_image.size() != this->page_size_)
+    {
+        std::string error_message = fmt::format ( "Page image (w={},h={}) should have the page size (w={},h={})"
+                                                , page_image.size().width, page_image.size().height
+                                                , this->page_size_.width, this->page_size_.height );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
         throw improc::value_error(std::move(error_message));
     }
-    this->page_image_ = std::move(page_image);
-    return (*this);
 }
@@ -6,8 +6,10 @@
 improc::PageElementDrawer::PageElementDrawer()  : improc::ElementDrawer()
                                                 , top_left_(cv::Point())
                                                 , element_box_(cv::Rect()) 
+                                                , element_scale_(1) 
                                                 , static_(false) 
-                                                , content_(std::optional<improc::DrawerVariant>()) {};
+                                                , content_(std::optional<improc::DrawerVariant>())
+                                                , element_id_(std::string()) {};
 
 /**
  * @brief Construct a new improc::PageElementDrawer object
@@ -34,6 +36,7 @@ improc::PageElementDrawer& improc::PageElementDrawer::Load(const improc::DrawerF
     static const std::string kTopLeftKey = "top-left";
     static const std::string kStaticKey  = "static";
     static const std::string kContentKey = "content";
+    static const std::string kIdKey      = "id";
     if (page_element_drawer_json.isMember(kTopLeftKey) == false)
     {
         std::string error_message = fmt::format("Key {} is missing from page element drawer json",kTopLeftKey);
@@ -54,6 +57,11 @@ improc::PageElementDrawer& improc::PageElementDrawer::Load(const improc::DrawerF
     {
         this->content_ = improc::json::ReadElement<std::string>(page_element_drawer_json[kContentKey]);
     }
+    this->element_id_.clear();
+    if (page_element_drawer_json.isMember(kIdKey) == true)
+    {
+        this->element_id_ = improc::json::ReadElement<std::string>(page_element_drawer_json[kIdKey]);
+    }
     return (*this);
 }
 
@@ -113,11 +121,41 @@ inline bool improc::PageElementDrawer::IsPixelPositionValid(int pixel_position,
 improc::PageElementDrawer& improc::PageElementDrawer::Allocate()
 {
     IMPROC_DRAWER_LOGGER_TRACE("Allocating page element...");
-    cv::Size element_size     = this->ElementDrawer::Draw(this->content_).size();
+    cv::Size native_size      = this->ElementDrawer::GetNativeSize(this->content_);
+    this->element_scale_      = this->ElementDrawer::GetScaleFactor(native_size);
     this->element_box_.x      = this->top_left_.x;
     this->element_box_.y      = this->top_left_.y;
-    this->element_box_.width  = element_size.width;
-    this->element_box_.height = element_size.height;
+    this->element_box_.width  = native_size.width  * this->element_scale_;
+    this->element_box_.height = native_size.height * this->element_scale_;
+    return (*this);
+}
+
+/**
+ * @brief Allocate page element with a known element box and scale factor, without computing the element size
+ * 
+ * @param element_box - page element box in page, previously obtained by allocating the page element
+ * @param element_scale - scale factor of page element, previously obtained by allocating the page element
+ */
+improc::PageElementDrawer& improc::PageElementDrawer::Allocate(const cv::Rect& element_box, unsigned int element_scale)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Allocating page element with element box...");
+    if (element_box.tl() != this->top_left_ || element_box.empty() == true)
+    {
+        std::string error_message = fmt::format ( "Element box (x={},y={},w={},h={}) should be non-empty and start at page element top left (x={},y={})"
+                                                , element_box.x, element_box.y, element_box.width, element_box.height
+                                                , this->top_left_.x, this->top_left_.y );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (element_scale == 0 || element_box.width % element_scale != 0 || element_box.height % element_scale != 0)
+    {
+        std::string error_message = fmt::format ( "Element box (w={},h={}) should be a multiple of scale factor {}"
+                                                , element_box.width, element_box.height, element_scale );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    this->element_box_   = element_box;
+    this->element_scale_ = element_scale;
     return (*this);
 }
 
@@ -140,13 +178,14 @@ void improc::PageElementDrawer::Draw(cv::Mat& page_image, const std::optional<im
 
     IMPROC_DRAWER_LOGGER_DEBUG  ( "Drawing element in x = {}, y = {} with size width = {}, height = {}"
                                 , this->element_box_.x, this->element_box_.y, this->element_box_.width, this->element_box_.height);
+    cv::Mat element_image = page_image(this->element_box_);
     if (this->static_ == false)
     {
-        this->ElementDrawer::Draw(std::move(message)).copyTo(page_image(this->element_box_));
+        this->ElementDrawer::DrawInto(element_image,std::move(message));
     }
     else
     {
-        this->ElementDrawer::Draw(this->content_).copyTo(page_image(this->element_box_));
+        this->ElementDrawer::DrawInto(element_image,this->content_);
     }
 }
 
@@ -172,11 +211,12 @@ bool improc::PageElementDrawer::Verify(const cv::Mat& page_image, const std::opt
     bool is_valid {};
     if (this->static_ == false)
     {
-        is_valid = this->ElementDrawer::Verify(page_image(this->element_box_),std::move(message));
+        unsigned int element_scale = this->ElementDrawer::GetScaleFactor(this->element_box_.size(),this->element_scale_,message);
+        is_valid = this->ElementDrawer::Verify(page_image(this->element_box_),element_scale,std::move(message));
     }
     else
     {
-        is_valid = this->ElementDrawer::Verify(page_image(this->element_box_),this->content_);
+        is_valid = this->ElementDrawer::Verify(page_image(this->element_box_),this->element_scale_,this->content_);
     }
     return is_valid;
 }
@@ -207,12 +247,12 @@ improc::PageElementDrawer& improc::PageElementDrawer::IncrementTopLeftBy(const c
  * @param page_elements - page elements to increment top left position
  * @param increment_top_left - top left increment in pixels
  * @param page_size - page size in pixels
- * @return std::list<improc::PageElementDrawer> - page elements with top leftr position changed
+ * @return std::vector<improc::PageElementDrawer> - page elements with top leftr position changed
  */
-std::list<improc::PageElementDrawer> improc::PageElementDrawer::IncrementTopLeftBy(std::list<improc::PageElementDrawer>&& page_elements, const cv::Point& increment_top_left, const cv::Size& page_size)
+std::vector<improc::PageElementDrawer> improc::PageElementDrawer::IncrementTopLeftBy(std::vector<improc::PageElementDrawer>&& page_elements, const cv::Point& increment_top_left, const cv::Size& page_size)
 {
     IMPROC_DRAWER_LOGGER_TRACE("Incrementing top left position on page elements...");
     std::for_each   ( page_elements.begin(),page_elements.end()
                     , [&increment_top_left,&page_size] (improc::PageElementDrawer& elem) {elem.IncrementTopLeftBy(increment_top_left,page_size);} );
-    return page_elements;
+    return std::move(page_elements);
 }
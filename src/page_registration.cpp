@@ -0,0 +1,275 @@
+#include <improc/drawer/page_registration.hpp>
+
+/**
+ * @brief Construct a new improc::PageRegistration object
+ * 
+ * @param render_plan - render plan of the allocated page to be verified
+ * @param fiducial_drawer_type - drawer type of the fiducial page elements
+ * @param search_margin - margin in pixels added around the expected location of page elements
+ */
+improc::PageRegistration::PageRegistration(const std::shared_ptr<const improc::RenderPlan>& render_plan, const std::string& fiducial_drawer_type, unsigned int search_margin)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Creating page registration...");
+    if (render_plan == nullptr)
+    {
+        std::string error_message = "Page should be allocated before creating a page registration";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    for (size_t elem_idx = 0; elem_idx < render_plan->get_number_elements(); elem_idx++)
+    {
+        if (render_plan->get_element_drawer(elem_idx).get_drawer_type() != fiducial_drawer_type)
+        {
+            continue;
+        }
+        if (render_plan->get_static_elements()[elem_idx] == false)
+        {
+            std::string error_message = fmt::format("Fiducial page element {} should be static",elem_idx);
+            IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+        this->fiducial_elements_.push_back(elem_idx);
+    }
+    if (this->fiducial_elements_.size() < improc::PageRegistration::kMinFiducials)
+    {
+        std::string error_message = fmt::format ( "Page should have at least {} fiducial page elements with drawer type {} ({} found)"
+                                                , improc::PageRegistration::kMinFiducials, fiducial_drawer_type, this->fiducial_elements_.size() );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    this->render_plan_   = render_plan;
+    this->search_margin_ = std::move(search_margin);
+}
+
+/**
+ * @brief Estimate homography from page to scan image. 
+ * The scan image is first assumed to be the page resized to the scan size, and every fiducial page element 
+ * is located by template matching inside a search window around its expected location. The homography is 
+ * the least squares solution for the centers of the fiducial page elements, with both sets of centers 
+ * normalized to the origin and to an average distance of sqrt(2) before solving.
+ * 
+ * @param scan_image - scanned page image with a single channel
+ * @return cv::Matx33d - homography that maps page coordinates into scan coordinates
+ */
+cv::Matx33d improc::PageRegistration::EstimateHomography(const cv::Mat& scan_image) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Estimating page homography...");
+    if (scan_image.empty() == true || scan_image.type() != improc::BaseDrawer::kImageDataType)
+    {
+        std::string error_message = "Scan image should be a non empty image with a single channel";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    const cv::Size page_size = this->render_plan_->get_page_size();
+    const double scale_x = static_cast<double>(scan_image.cols) / page_size.width;
+    const double scale_y = static_cast<double>(scan_image.rows) / page_size.height;
+
+    std::vector<cv::Point2d> page_centers {};
+    std::vector<cv::Point2d> scan_centers {};
+    page_centers.reserve(this->fiducial_elements_.size());
+    scan_centers.reserve(this->fiducial_elements_.size());
+    cv::Mat fiducial_template {};
+    cv::Mat match_scores {};
+    for (size_t fiducial_idx = 0; fiducial_idx < this->fiducial_elements_.size(); fiducial_idx++)
+    {
+        const cv::Rect& element_box = this->render_plan_->get_element_boxes()[this->fiducial_elements_[fiducial_idx]];
+        cv::Rect expected_box   ( cvRound(element_box.x * scale_x), cvRound(element_box.y * scale_y)
+                                , std::max(cvRound(element_box.width * scale_x),1), std::max(cvRound(element_box.height * scale_y),1) );
+        cv::Rect search_window = this->GetSearchWindow(expected_box,scan_image);
+        if (search_window.width < expected_box.width || search_window.height < expected_box.height)
+        {
+            std::string error_message = fmt::format("Search window of fiducial page element {} should be inside scan image",this->fiducial_elements_[fiducial_idx]);
+            IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+        cv::resize(this->render_plan_->get_background()(element_box),fiducial_template,expected_box.size(),0,0,cv::INTER_AREA);
+        cv::matchTemplate(scan_image(search_window),fiducial_template,match_scores,cv::TM_SQDIFF_NORMED);
+        cv::Point match_location {};
+        cv::minMaxLoc(match_scores,nullptr,nullptr,&match_location,nullptr);
+
+        page_centers.push_back(cv::Point2d  ( element_box.x + (element_box.width  - 1) / 2.0
+                                            , element_box.y + (element_box.height - 1) / 2.0 ));
+        scan_centers.push_back(cv::Point2d  ( search_window.x + match_location.x + (expected_box.width  - 1) / 2.0
+                                            , search_window.y + match_location.y + (expected_box.height - 1) / 2.0 ));
+        IMPROC_DRAWER_LOGGER_DEBUG("Fiducial page element {} found at x = {}, y = {}",this->fiducial_elements_[fiducial_idx],scan_centers.back().x,scan_centers.back().y);
+    }
+
+    // Centers are normalized before solving, since the equations mix pixel coordinates with their products
+    const cv::Matx33d page_normalization = improc::PageRegistration::GetNormalization(page_centers);
+    const cv::Matx33d scan_normalization = improc::PageRegistration::GetNormalization(scan_centers);
+    cv::perspectiveTransform(page_centers,page_centers,page_normalization);
+    cv::perspectiveTransform(scan_centers,scan_centers,scan_normalization);
+    cv::Mat equations (2 * static_cast<int>(this->fiducial_elements_.size()),8,CV_64FC1,cv::Scalar(0));
+    cv::Mat positions (2 * static_cast<int>(this->fiducial_elements_.size()),1,CV_64FC1);
+    for (size_t fiducial_idx = 0; fiducial_idx < this->fiducial_elements_.size(); fiducial_idx++)
+    {
+        const cv::Point2d& page_center = page_centers[fiducial_idx];
+        const cv::Point2d& scan_center = scan_centers[fiducial_idx];
+        double* equation_x_ptr = equations.ptr<double>(2 * static_cast<int>(fiducial_idx));
+        double* equation_y_ptr = equations.ptr<double>(2 * static_cast<int>(fiducial_idx) + 1);
+        equation_x_ptr[0] = page_center.x; equation_x_ptr[1] = page_center.y; equation_x_ptr[2] = 1;
+        equation_x_ptr[6] = -page_center.x * scan_center.x; equation_x_ptr[7] = -page_center.y * scan_center.x;
+        equation_y_ptr[3] = page_center.x; equation_y_ptr[4] = page_center.y; equation_y_ptr[5] = 1;
+        equation_y_ptr[6] = -page_center.x * scan_center.y; equation_y_ptr[7] = -page_center.y * scan_center.y;
+        positions.at<double>(2 * static_cast<int>(fiducial_idx))     = scan_center.x;
+        positions.at<double>(2 * static_cast<int>(fiducial_idx) + 1) = scan_center.y;
+    }
+
+    cv::Mat homography_params {};
+    bool    is_solved = cv::solve(equations,positions,homography_params,cv::DECOMP_SVD);
+    cv::Matx33d homography {};
+    if (is_solved == true)
+    {
+        const double* params_ptr = homography_params.ptr<double>();
+        cv::Matx33d normalized_homography   ( params_ptr[0], params_ptr[1], params_ptr[2]
+                                            , params_ptr[3], params_ptr[4], params_ptr[5]
+                                            , params_ptr[6], params_ptr[7], 1.0 );
+        homography = scan_normalization.inv() * normalized_homography * page_normalization;
+    }
+    if (is_solved == false || std::abs(homography(2,2)) <= std::numeric_limits<double>::epsilon())
+    {
+        std::string error_message = "Homography could not be estimated from fiducial page elements";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_03: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    return homography * (1.0 / homography(2,2));
+}
+
+/**
+ * @brief Verify scanned page image.
+ * Page elements whose search window falls outside of the scan image are reported as invalid.
+ * 
+ * @param scan_image - scanned page image with a single channel
+ * @param context - list of messages to be considered in page elements, including static page elements
+ * @return VerificationReport - verification result and time of every page element
+ */
+improc::VerificationReport improc::PageRegistration::Verify(const cv::Mat& scan_image, const std::list<std::optional<improc::DrawerVariant>>& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying scanned page...");
+    if (context.size() != this->render_plan_->get_number_elements())
+    {
+        std::string error_message = fmt::format ( "Number of elements in context ({}) different than the number of elements in page ({})"
+                                                , context.size(), this->render_plan_->get_number_elements() );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    cv::Matx33d homography = this->EstimateHomography(scan_image);
+
+    std::vector<improc::VerificationReport::ElementResult> element_results {};
+    element_results.reserve(context.size());
+    std::list<std::optional<improc::DrawerVariant>>::const_iterator message_iter = context.begin();
+    for (size_t elem_idx = 0; elem_idx < context.size(); elem_idx++, message_iter++)
+    {
+        std::chrono::steady_clock::time_point elem_start_time = std::chrono::steady_clock::now();
+        bool is_valid = this->VerifyElement(scan_image,homography,elem_idx,*message_iter);
+        element_results.push_back(improc::VerificationReport::ElementResult {true,is_valid,std::chrono::steady_clock::now() - elem_start_time});
+    }
+    improc::VerificationReport report {std::move(element_results),std::chrono::steady_clock::now() - start_time};
+    IMPROC_DRAWER_LOGGER_DEBUG("Verified {} page elements of scanned page",report.GetNumberVerified());
+    return report;
+}
+
+/**
+ * @brief Obtain search window around a region of the scan image, clipped to the scan image
+ * 
+ * @param region - region of the scan image
+ * @param scan_image - scanned page image
+ * @return cv::Rect - region expanded by the search margin and clipped to the scan image
+ */
+cv::Rect improc::PageRegistration::GetSearchWindow(const cv::Rect& region, const cv::Mat& scan_image) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining search window...");
+    const int margin = static_cast<int>(this->search_margin_);
+    cv::Rect search_window (region.x - margin,region.y - margin,region.width + 2 * margin,region.height + 2 * margin);
+    return search_window & cv::Rect(0,0,scan_image.cols,scan_image.rows);
+}
+
+/**
+ * @brief Obtain similarity transform that moves the centroid of the points to the origin and scales their average 
+ * distance to the origin to sqrt(2)
+ * 
+ * @param points - points to be normalized
+ * @return cv::Matx33d - normalizing transform, without scaling if every point is at the centroid
+ */
+cv::Matx33d improc::PageRegistration::GetNormalization(const std::vector<cv::Point2d>& points)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining point normalization...");
+    cv::Point2d centroid {};
+    std::for_each(points.begin(),points.end(),[&centroid] (const cv::Point2d& point) {centroid += point;});
+    centroid *= 1.0 / static_cast<double>(points.size());
+    double average_distance = 0;
+    std::for_each(points.begin(),points.end(),[&average_distance,&centroid] (const cv::Point2d& point) {average_distance += cv::norm(point - centroid);});
+    average_distance /= static_cast<double>(points.size());
+    const double scale = average_distance > 0 ? std::sqrt(2.0) / average_distance : 1.0;
+    return cv::Matx33d  ( scale, 0, -scale * centroid.x
+                        , 0, scale, -scale * centroid.y
+                        , 0, 0, 1 );
+}
+
+/**
+ * @brief Verify a single page element of a scanned page image. 
+ * The search window around the element box, extended by the search margin, is rectified into page coordinates 
+ * and the expected element image is located in it by template matching, correcting the residual error of the 
+ * homography. Static page elements are located with the page background and dynamic page elements with the 
+ * element drawn with the message. The page element is then sampled at the located box with one pixel at the 
+ * center of every module, binarized and verified with a unit scale factor. 
+ * Static page elements are verified with their content, ignoring the given message.
+ * 
+ * @param scan_image - scanned page image with a single channel
+ * @param homography - homography that maps page coordinates into scan coordinates
+ * @param elem_idx - index of page element
+ * @param message - message to be considered in page element
+ * @return bool - true if page element is correct, false otherwise.
+ */
+bool improc::PageRegistration::VerifyElement(const cv::Mat& scan_image, const cv::Matx33d& homography, size_t elem_idx, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying page element {} of scanned page...",elem_idx);
+    const cv::Rect& element_box = this->render_plan_->get_element_boxes()[elem_idx];
+    const int       margin      = static_cast<int>(this->search_margin_);
+    const cv::Rect  window_box  (element_box.x - margin,element_box.y - margin,element_box.width + 2 * margin,element_box.height + 2 * margin);
+    std::vector<cv::Point2d> window_corners { cv::Point2d(window_box.x,window_box.y), cv::Point2d(window_box.x + window_box.width,window_box.y)
+                                            , cv::Point2d(window_box.x,window_box.y + window_box.height), cv::Point2d(window_box.x + window_box.width,window_box.y + window_box.height) };
+    std::vector<cv::Point2d> scan_corners {};
+    cv::perspectiveTransform(window_corners,scan_corners,homography);
+    std::vector<cv::Point> scan_window_corners {};
+    std::for_each(scan_corners.begin(),scan_corners.end(),[&scan_window_corners] (const cv::Point2d& corner) {scan_window_corners.push_back(cv::Point(cvFloor(corner.x),cvFloor(corner.y)));});
+    if ((cv::boundingRect(scan_window_corners) & cv::Rect(0,0,scan_image.cols,scan_image.rows)).empty() == true)
+    {
+        IMPROC_DRAWER_LOGGER_DEBUG("Search window of page element {} outside scan image",elem_idx);
+        return false;
+    }
+
+    thread_local cv::Mat window_image {};
+    cv::Matx33d window_to_page  ( 1, 0, window_box.x
+                                , 0, 1, window_box.y
+                                , 0, 0, 1 );
+    cv::warpPerspective ( scan_image,window_image,homography * window_to_page,window_box.size()
+                        , cv::INTER_LINEAR | cv::WARP_INVERSE_MAP, cv::BORDER_CONSTANT, cv::Scalar(improc::BaseDrawer::kWhiteValue) );
+
+    const improc::ElementDrawer& element_drawer = this->render_plan_->get_element_drawer(elem_idx);
+    const bool is_static = this->render_plan_->get_static_elements()[elem_idx];
+    const std::optional<improc::DrawerVariant>& element_message = is_static == true ? this->render_plan_->get_static_contents()[elem_idx] 
+                                                                                    : message;
+    cv::Mat element_image = is_static == true ? this->render_plan_->get_background()(element_box) : element_drawer.Draw(element_message);
+    cv::Point element_location {margin,margin};
+    if (element_image.size() == element_box.size())
+    {
+        thread_local cv::Mat match_scores {};
+        cv::matchTemplate(window_image,element_image,match_scores,cv::TM_SQDIFF_NORMED);
+        cv::minMaxLoc(match_scores,nullptr,nullptr,&element_location,nullptr);
+        IMPROC_DRAWER_LOGGER_DEBUG  ( "Page element {} located with offset x = {}, y = {}"
+                                    , elem_idx, element_location.x - margin, element_location.y - margin );
+    }
+
+    const unsigned int element_scale = is_static == true ? this->render_plan_->get_element_scales()[elem_idx] 
+                                                         : element_drawer.GetScaleFactor(element_box.size(),this->render_plan_->get_element_scales()[elem_idx],element_message);
+    cv::Matx23d native_to_window( element_scale, 0, element_location.x + (element_scale - 1) / 2.0
+                                , 0, element_scale, element_location.y + (element_scale - 1) / 2.0 );
+    thread_local cv::Mat native_image {};
+    cv::warpAffine  ( window_image,native_image,native_to_window
+                    , cv::Size(element_box.width / static_cast<int>(element_scale),element_box.height / static_cast<int>(element_scale))
+                    , cv::INTER_LINEAR | cv::WARP_INVERSE_MAP, cv::BORDER_CONSTANT, cv::Scalar(improc::BaseDrawer::kWhiteValue) );
+    cv::threshold(native_image,native_image,0,improc::BaseDrawer::kWhiteValue,cv::THRESH_BINARY | cv::THRESH_OTSU);
+    return element_drawer.Verify(native_image,1,element_message);
+}
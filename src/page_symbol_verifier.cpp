@@ -0,0 +1,221 @@
+#include <improc/drawer/page_symbol_verifier.hpp>
+
+/**
+ * @brief Construct a new improc::PageSymbolVerifier object
+ * 
+ * @param render_plan - render plan of the allocated page to be verified
+ * @param symbol_drawer_types - drawer types whose page elements are decoded in the whole page pass, with their symbol format
+ */
+improc::PageSymbolVerifier::PageSymbolVerifier(const std::shared_ptr<const improc::RenderPlan>& render_plan, const std::unordered_map<std::string,ZXing::BarcodeFormat>& symbol_drawer_types)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Creating page symbol verifier...");
+    if (render_plan == nullptr)
+    {
+        std::string error_message = "Page should be allocated before creating a page symbol verifier";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+    this->render_plan_ = render_plan;
+    this->symbol_elements_.assign(render_plan->get_number_elements(),false);
+    this->symbol_formats_.assign(render_plan->get_number_elements(),ZXing::BarcodeFormat::None);
+    this->page_pass_elements_.assign(render_plan->get_number_elements(),false);
+    for (size_t elem_idx = 0; elem_idx < render_plan->get_number_elements(); elem_idx++)
+    {
+        std::unordered_map<std::string,ZXing::BarcodeFormat>::const_iterator symbol_iter = symbol_drawer_types.find(render_plan->get_element_drawer(elem_idx).get_drawer_type());
+        if (symbol_iter != symbol_drawer_types.end())
+        {
+            this->symbol_elements_[elem_idx] = true;
+            this->symbol_formats_[elem_idx]  = symbol_iter->second;
+        }
+    }
+
+    int                  number_symbols = 0;
+    bool                 try_rotate     = false;
+    ZXing::BarcodeFormats symbol_formats {};
+    for (size_t elem_idx = 0; elem_idx < render_plan->get_number_elements(); elem_idx++)
+    {
+        if (this->symbol_elements_[elem_idx] == false)
+        {
+            continue;
+        }
+        const improc::ElementDrawer&        element_drawer = render_plan->get_element_drawer(elem_idx);
+        std::optional<improc::VerifyEffort> verify_effort  = element_drawer.get_drawer()->GetVerifyEffort();
+        if (   verify_effort.has_value() == false || verify_effort.value() != improc::VerifyEffort::kRobust 
+            || this->HasQuietZone(elem_idx) == false )
+        {
+            continue;
+        }
+        this->page_pass_elements_[elem_idx] = true;
+        symbol_formats = symbol_formats | this->symbol_formats_[elem_idx];
+        number_symbols++;
+
+        // Linear symbols rotated by 90 or 270 degrees are only read when the decoding pass also tries rotated rows
+        std::optional<improc::RotationType> rotation = element_drawer.get_rotation();
+        if (   rotation.has_value() == true 
+            && (rotation.value() == improc::RotationType::Value::k90Deg || rotation.value() == improc::RotationType::Value::k270Deg) )
+        {
+            try_rotate = true;
+        }
+    }
+    this->reader_options_ = ZXing::ReaderOptions() .setFormats(symbol_formats)
+                                                   .setTryHarder(true)
+                                                   .setTryRotate(try_rotate)
+                                                   .setTryInvert(false)
+                                                   .setMaxNumberOfSymbols(std::max(number_symbols,1));
+    IMPROC_DRAWER_LOGGER_DEBUG  ( "Page symbol verifier with {} symbols in {} page elements, {} decoded in the page pass"
+                                , std::count(this->symbol_elements_.begin(),this->symbol_elements_.end(),true)
+                                , render_plan->get_number_elements(), number_symbols );
+}
+
+/**
+ * @brief Verify page image with a single decoding pass for symbol page elements.
+ * Decoded symbols are assigned to the last page element of the decoding pass, in page order, with the symbol 
+ * format and whose element box contains the symbol center. Page elements with a string message are valid when 
+ * their decoded symbol has the element message and invalid when more than one symbol is decoded in their element 
+ * box. Messages are compared with the raw decoded bytes, without character set conversion. Page elements 
+ * without a decoded symbol or without a string message and the remaining page elements are verified 
+ * individually. The time of the decoding pass is only included in the page verification time.
+ *
+ * @param page_image - page image to be verified
+ * @param context - list of messages to be considered in page elements, including static page elements
+ * @return VerificationReport - verification result and time of every page element
+ */
+improc::VerificationReport improc::PageSymbolVerifier::Verify(const cv::Mat& page_image, const std::list<std::optional<improc::DrawerVariant>>& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying page symbols...");
+    if (page_image.size() != this->render_plan_->get_page_size() || page_image.type() != improc::BaseDrawer::kImageDataType)
+    {
+        std::string error_message = fmt::format ( "Page image (w={},h={}) should have the page size (w={},h={}) and a single channel"
+                                                , page_image.size().width, page_image.size().height
+                                                , this->render_plan_->get_page_size().width, this->render_plan_->get_page_size().height );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (context.size() != this->render_plan_->get_number_elements())
+    {
+        std::string error_message = fmt::format ( "Number of elements in context ({}) different than the number of elements in page ({})"
+                                                , context.size(), this->render_plan_->get_number_elements() );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    std::vector<std::optional<std::string>> decoded_texts (this->symbol_elements_.size(),std::nullopt);
+    std::vector<size_t>                     number_decoded (this->symbol_elements_.size(),0);
+    if (std::find(this->page_pass_elements_.begin(),this->page_pass_elements_.end(),true) != this->page_pass_elements_.end())
+    {
+        ZXing::Results symbols = ZXing::ReadBarcodes( ZXing::ImageView  ( page_image.data
+                                                                        , page_image.cols
+                                                                        , page_image.rows
+                                                                        , ZXing::ImageFormat::Lum
+                                                                        , static_cast<int>(page_image.step) )
+                                                    , this->reader_options_ );
+        for (const ZXing::Result& symbol : symbols)
+        {
+            std::optional<size_t> elem_idx = this->FindSymbolElement(symbol);
+            if (symbol.isValid() == true && elem_idx.has_value() == true)
+            {
+                decoded_texts[elem_idx.value()] = std::string(symbol.bytes().begin(),symbol.bytes().end());
+                number_decoded[elem_idx.value()]++;
+            }
+        }
+    }
+
+    std::vector<improc::VerificationReport::ElementResult> element_results {};
+    element_results.reserve(this->symbol_elements_.size());
+    std::list<std::optional<improc::DrawerVariant>>::const_iterator message_iter = context.begin();
+    for (size_t elem_idx = 0; elem_idx < this->symbol_elements_.size(); elem_idx++, message_iter++)
+    {
+        std::chrono::steady_clock::time_point elem_start_time = std::chrono::steady_clock::now();
+        const std::optional<improc::DrawerVariant>& message = this->render_plan_->get_static_elements()[elem_idx] == true ? this->render_plan_->get_static_contents()[elem_idx] 
+                                                                                                                          : *message_iter;
+        if (number_decoded[elem_idx] == 0 || message.has_value() == false || std::holds_alternative<std::string>(message.value()) == false)
+        {
+            bool is_valid = this->render_plan_->VerifyElement(page_image,elem_idx,*message_iter);
+            element_results.push_back(improc::VerificationReport::ElementResult {true,is_valid,std::chrono::steady_clock::now() - elem_start_time});
+            continue;
+        }
+        bool is_valid = number_decoded[elem_idx] == 1 && std::get<std::string>(message.value()) == decoded_texts[elem_idx].value();
+        element_results.push_back(improc::VerificationReport::ElementResult {true,is_valid,std::chrono::nanoseconds::zero()});
+    }
+    improc::VerificationReport report {std::move(element_results),std::chrono::steady_clock::now() - start_time};
+    IMPROC_DRAWER_LOGGER_DEBUG  ( "Verified {} page elements with {} symbols decoded in page"
+                                , this->symbol_elements_.size(), std::count_if(number_decoded.begin(),number_decoded.end(),[] (size_t number) {return number > 0;}) );
+    return report;
+}
+
+/**
+ * @brief Check if a symbol page element has a quiet zone. 
+ * The quiet zone is measured in modules of the symbol format, using the scale factor obtained when allocating.
+ * 
+ * @param elem_idx - index of symbol page element
+ * @return bool - true if the element box extended by the quiet zone is inside the page and does not overlap other page elements
+ */
+bool improc::PageSymbolVerifier::HasQuietZone(size_t elem_idx) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Checking quiet zone of page element...");
+    const std::vector<cv::Rect>& element_boxes = this->render_plan_->get_element_boxes();
+    const int quiet_zone = improc::PageSymbolVerifier::GetQuietZoneModules(this->symbol_formats_[elem_idx]) 
+                         * static_cast<int>(this->render_plan_->get_element_scales()[elem_idx]);
+    const cv::Rect& element_box = element_boxes[elem_idx];
+    cv::Rect quiet_zone_box { element_box.x - quiet_zone, element_box.y - quiet_zone
+                            , element_box.width + 2 * quiet_zone, element_box.height + 2 * quiet_zone };
+    if ((quiet_zone_box & cv::Rect(cv::Point(0,0),this->render_plan_->get_page_size())) != quiet_zone_box)
+    {
+        IMPROC_DRAWER_LOGGER_DEBUG("Quiet zone of page element {} is outside the page",elem_idx);
+        return false;
+    }
+    for (size_t other_elem_idx = 0; other_elem_idx < element_boxes.size(); other_elem_idx++)
+    {
+        if (other_elem_idx != elem_idx && (quiet_zone_box & element_boxes[other_elem_idx]).empty() == false)
+        {
+            IMPROC_DRAWER_LOGGER_DEBUG("Quiet zone of page element {} overlaps page element {}",elem_idx,other_elem_idx);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Obtain symbol page element of a decoded symbol
+ * 
+ * @param symbol - symbol decoded in page image
+ * @return std::optional<size_t> - index of the last page element of the decoding pass with the symbol format and whose 
+ * element box contains the symbol center, empty if none
+ */
+std::optional<size_t> improc::PageSymbolVerifier::FindSymbolElement(const ZXing::Result& symbol) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining page element of decoded symbol...");
+    const ZXing::Position& position = symbol.position();
+    cv::Point symbol_center { (position.topLeft().x + position.topRight().x + position.bottomRight().x + position.bottomLeft().x) / 4
+                            , (position.topLeft().y + position.topRight().y + position.bottomRight().y + position.bottomLeft().y) / 4 };
+    const std::vector<cv::Rect>& element_boxes = this->render_plan_->get_element_boxes();
+    for (size_t elem_idx = element_boxes.size(); elem_idx > 0; elem_idx--)
+    {
+        if (   this->page_pass_elements_[elem_idx - 1] == true && this->symbol_formats_[elem_idx - 1] == symbol.format() 
+            && element_boxes[elem_idx - 1].contains(symbol_center) == true )
+        {
+            return elem_idx - 1;
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Obtain number of modules of the quiet zone required around a symbol
+ * 
+ * @param symbol_format - symbol format
+ * @return int - number of modules of the quiet zone
+ */
+int improc::PageSymbolVerifier::GetQuietZoneModules(ZXing::BarcodeFormat symbol_format)
+{
+    static constexpr int kQrCodeQuietZone     = 4;
+    static constexpr int kDataMatrixQuietZone = 1;
+    static constexpr int kLinearQuietZone     = 10;
+    switch (symbol_format)
+    {
+        case ZXing::BarcodeFormat::QRCode       : return kQrCodeQuietZone;
+        case ZXing::BarcodeFormat::DataMatrix   : return kDataMatrixQuietZone;
+        default                                 : return kLinearQuietZone;
+    }
+}
@@ -1,5 +1,18 @@
 #include <improc/drawer/drawer_types/qrcode_drawer.hpp>
 
+namespace
+{
+    /**
+     * @brief Characters of the qr-code alphanumeric mode, indexed by character value
+     */
+    constexpr std::string_view kAlphanumericCharset = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+
+    /**
+     * @brief Number of characters of the qr-code numeric mode
+     */
+    constexpr unsigned int kNumericCharsetSize = 10;
+}
+
 /**
  * @brief Construct a new improc::ErrorCorrectionLevel object
  */
@@ -21,11 +34,57 @@ improc::qrcode::ErrorCorrectionLevel::ErrorCorrectionLevel(const std::string& er
     this->value_ = kToElemType.at(improc::String::ToLower(std::move(error_correction_level_str)));
 }
 
+/**
+ * @brief Construct a new improc::SegmentMode object
+ */
+improc::qrcode::SegmentMode::SegmentMode(): value_(improc::qrcode::SegmentMode::kAuto) {};
+
+/**
+ * @brief Construct a new improc::SegmentMode object
+ * 
+ * @param segment_mode_str - segment mode description as string
+ */
+improc::qrcode::SegmentMode::SegmentMode(const std::string& segment_mode_str)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining segment mode from string {}...",segment_mode_str);
+    static const std::unordered_map<std::string,SegmentMode::Value> kToSegmentMode = { {"auto"        ,SegmentMode::Value::kAuto        }
+                                                                                     , {"numeric"     ,SegmentMode::Value::kNumeric     }
+                                                                                     , {"alphanumeric",SegmentMode::Value::kAlphanumeric}
+                                                                                     , {"byte"        ,SegmentMode::Value::kByte        }
+                                                                                     };
+    this->value_ = kToSegmentMode.at(improc::String::ToLower(std::move(segment_mode_str)));
+}
+
+/**
+ * @brief Construct a new improc::EncoderType object
+ */
+improc::qrcode::EncoderType::EncoderType(): value_(improc::qrcode::EncoderType::kQrCodeGen) {};
+
+/**
+ * @brief Construct a new improc::EncoderType object
+ * 
+ * @param encoder_type_str - encoder type description as string
+ */
+improc::qrcode::EncoderType::EncoderType(const std::string& encoder_type_str)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining encoder type from string {}...",encoder_type_str);
+    static const std::unordered_map<std::string,EncoderType::Value> kToEncoderType = { {"qrcodegen",EncoderType::Value::kQrCodeGen}
+                                                                                     , {"builtin"  ,EncoderType::Value::kBuiltin  }
+                                                                                     };
+    this->value_ = kToEncoderType.at(improc::String::ToLower(std::move(encoder_type_str)));
+}
+
 /**
  * @brief Construct a new improc::QrCodeDrawer object
  */
 improc::QrCodeDrawer::QrCodeDrawer(): improc::BaseDrawer()
-                                    , error_correction_level_(improc::qrcode::ErrorCorrectionLevel()) {};
+                                    , error_correction_level_(improc::qrcode::ErrorCorrectionLevel())
+                                    , verify_effort_(improc::VerifyEffort())
+                                    , segment_mode_(improc::qrcode::SegmentMode())
+                                    , min_version_(qrcodegen::QrCode::MIN_VERSION)
+                                    , max_version_(qrcodegen::QrCode::MAX_VERSION)
+                                    , mask_(std::nullopt)
+                                    , encoder_type_(improc::qrcode::EncoderType()) {};
 
 /**
  * @brief Construct a new improc::QrCodeDrawer object
@@ -46,6 +105,12 @@ improc::QrCodeDrawer& improc::QrCodeDrawer::Load(const Json::Value& drawer_json)
 {
     IMPROC_DRAWER_LOGGER_TRACE("Creating qr-code drawer...");
     static const std::string kErrorCorrectionKey = "error-correction-level";
+    static const std::string kVerifyEffortKey    = "verify-effort";
+    static const std::string kSegmentModeKey     = "segment-mode";
+    static const std::string kMinVersionKey      = "min-version";
+    static const std::string kMaxVersionKey      = "max-version";
+    static const std::string kMaskKey            = "mask";
+    static const std::string kEncoderKey         = "encoder";
     if (drawer_json.isMember(kErrorCorrectionKey) == false) 
     {
         std::string error_message = fmt::format("Key {} is missing from qr-code drawer json",kErrorCorrectionKey);
@@ -53,6 +118,48 @@ improc::QrCodeDrawer& improc::QrCodeDrawer::Load(const Json::Value& drawer_json)
         throw improc::json_error(std::move(error_message));
     }
     this->error_correction_level_ = improc::qrcode::ErrorCorrectionLevel(improc::json::ReadElement<std::string>(drawer_json[kErrorCorrectionKey]));
+    this->verify_effort_ = improc::VerifyEffort();
+    if (drawer_json.isMember(kVerifyEffortKey) == true)
+    {
+        this->verify_effort_ = improc::VerifyEffort(improc::json::ReadElement<std::string>(drawer_json[kVerifyEffortKey]));
+    }
+    this->segment_mode_ = improc::qrcode::SegmentMode();
+    if (drawer_json.isMember(kSegmentModeKey) == true)
+    {
+        this->segment_mode_ = improc::qrcode::SegmentMode(improc::json::ReadElement<std::string>(drawer_json[kSegmentModeKey]));
+    }
+
+    this->min_version_ = drawer_json.isMember(kMinVersionKey) == true ? improc::json::ReadElement<int>(drawer_json[kMinVersionKey]) : qrcodegen::QrCode::MIN_VERSION;
+    this->max_version_ = drawer_json.isMember(kMaxVersionKey) == true ? improc::json::ReadElement<int>(drawer_json[kMaxVersionKey]) : qrcodegen::QrCode::MAX_VERSION;
+    if (   this->min_version_ < qrcodegen::QrCode::MIN_VERSION || this->min_version_ > this->max_version_ 
+        || this->max_version_ > qrcodegen::QrCode::MAX_VERSION )
+    {
+        std::string error_message = fmt::format ( "Qr-code version range [{},{}] should be an ordered range between {} and {}"
+                                                , this->min_version_, this->max_version_, qrcodegen::QrCode::MIN_VERSION, qrcodegen::QrCode::MAX_VERSION );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    this->mask_ = std::nullopt;
+    if (drawer_json.isMember(kMaskKey) == true)
+    {
+        int mask = improc::json::ReadElement<int>(drawer_json[kMaskKey]);
+        if (mask < 0 || mask >= improc::QrCodeDrawer::kNumberMasks)
+        {
+            std::string error_message = fmt::format("Qr-code mask {} should be between 0 and {}",mask,improc::QrCodeDrawer::kNumberMasks - 1);
+            IMPROC_DRAWER_LOGGER_ERROR("ERROR_03: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+        this->mask_ = mask;
+    }
+
+    this->encoder_type_ = improc::qrcode::EncoderType();
+    if (drawer_json.isMember(kEncoderKey) == true)
+    {
+        this->encoder_type_ = improc::qrcode::EncoderType(improc::json::ReadElement<std::string>(drawer_json[kEncoderKey]));
+    }
+    IMPROC_DRAWER_LOGGER_DEBUG  ( "Qr-code drawer with versions [{},{}], {} segment mode and {} encoder"
+                                , this->min_version_, this->max_version_, this->segment_mode_.ToString(), this->encoder_type_.ToString() );
     return (*this);
 };
 
@@ -62,50 +169,336 @@ improc::QrCodeDrawer& improc::QrCodeDrawer::Load(const Json::Value& drawer_json)
  * @param message - message to be encoded in qr-code
  * @return cv::Mat - qr-code image with encoded message
  */
-cv::Mat improc::QrCodeDrawer::Draw(const std::optional<improc::DrawerVariant>& message)
+cv::Mat improc::QrCodeDrawer::Draw(const std::optional<improc::DrawerVariant>& message) const
 {
     IMPROC_DRAWER_LOGGER_TRACE("Drawing qrcode...");
-    qrcodegen::QrCode qrcode_data = qrcodegen::QrCode::encodeText(std::get<std::string>(message.value()).c_str(),this->error_correction_level_.ToQrCodeGen());
+    if (this->encoder_type_ == improc::qrcode::EncoderType::kBuiltin)
+    {
+        const improc::qrcode::QrCodeEncoder& qrcode_data = this->EncodeBuiltin(message);
+        cv::Mat qrcode (qrcode_data.get_size(),qrcode_data.get_size(),improc::BaseDrawer::kImageDataType);
+        improc::QrCodeDrawer::RasterizeQrCode(qrcode_data,qrcode);
+        return qrcode;
+    }
+    qrcodegen::QrCode qrcode_data = this->Encode(message);
     int qrcode_size = qrcode_data.getSize();
-    cv::Mat qrcode (qrcode_size,qrcode_size,improc::BaseDrawer::kImageDataType,improc::BaseDrawer::kWhiteValue);
-    for (size_t pixel_y = 0; pixel_y < qrcode_size; pixel_y++)
+    cv::Mat qrcode (qrcode_size,qrcode_size,improc::BaseDrawer::kImageDataType);
+    improc::QrCodeDrawer::RasterizeQrCode(qrcode_data,qrcode);
+    return qrcode;
+};
+
+/**
+ * @brief Draw qr-code directly in a region of interest
+ * 
+ * @param roi - region of interest with the size of the qr-code image
+ * @param message - message to be encoded in qr-code
+ */
+void improc::QrCodeDrawer::DrawInto(cv::Mat& roi, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing qrcode into region of interest...");
+    if (this->encoder_type_ == improc::qrcode::EncoderType::kBuiltin)
     {
-        auto qrcode_row_ptr = qrcode.ptr<uint8_t>(pixel_y);
-        for (size_t pixel_x = 0; pixel_x < qrcode_size; pixel_x++)
+        const improc::qrcode::QrCodeEncoder& qrcode_data = this->EncodeBuiltin(message);
+        improc::BaseDrawer::ValidateRoi(roi,cv::Size(qrcode_data.get_size(),qrcode_data.get_size()));
+        improc::QrCodeDrawer::RasterizeQrCode(qrcode_data,roi);
+        return;
+    }
+    qrcodegen::QrCode qrcode_data = this->Encode(message);
+    improc::BaseDrawer::ValidateRoi(roi,cv::Size(qrcode_data.getSize(),qrcode_data.getSize()));
+    improc::QrCodeDrawer::RasterizeQrCode(qrcode_data,roi);
+}
+
+/**
+ * @brief Obtain size of qr-code image without encoding the message. 
+ * The qr-code version is the smallest version of the version range whose data capacity fits the message 
+ * segments, as chosen by the qr-code encoder.
+ * 
+ * @param message - message to be encoded in qr-code
+ * @return cv::Size - size of qr-code image
+ */
+cv::Size improc::QrCodeDrawer::GetOutputSize(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining qrcode size...");
+    auto [segment_mode, segment_data] = this->GetSegment(message);
+    for (int version = this->min_version_; version <= this->max_version_; version++)
+    {
+        int data_used_bits = improc::qrcode::QrCodeEncoder::GetTotalBits(segment_data,segment_mode,version);
+        if (data_used_bits != -1 && data_used_bits <= improc::qrcode::QrCodeEncoder::GetNumDataCodewords(version,this->error_correction_level_.ToQrCodeGen()) * 8)
         {
-            if (qrcode_data.getModule(pixel_x,pixel_y) == true)
-            {
-                qrcode_row_ptr[pixel_x] = improc::BaseDrawer::kBlackValue;
-            }
+            int qrcode_size = version * 4 + 17;
+            return cv::Size(qrcode_size,qrcode_size);
         }
     }
-    return qrcode;
-};
+
+    std::string error_message = "Message too long to be encoded in qr-code";
+    IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+    throw qrcodegen::data_too_long(std::move(error_message));
+}
+
+/**
+ * @brief Obtain verify effort of qrcode drawer
+ * 
+ * @return std::optional<VerifyEffort> - verify effort
+ */
+std::optional<improc::VerifyEffort> improc::QrCodeDrawer::GetVerifyEffort() const
+{
+    return this->verify_effort_;
+}
 
 /**
- * @brief Verify message encoded in qr-code
+ * @brief Write qr-code modules in image, one pixel per module
+ * 
+ * @param qrcode_data - encoded qr-code
+ * @param roi - image with the size of the qr-code
+ */
+void improc::QrCodeDrawer::RasterizeQrCode(const qrcodegen::QrCode& qrcode_data, cv::Mat& roi)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Rasterizing qrcode...");
+    int qrcode_size = qrcode_data.getSize();
+    for (int pixel_y = 0; pixel_y < qrcode_size; pixel_y++)
+    {
+        auto qrcode_row_ptr = roi.ptr<uint8_t>(pixel_y);
+        for (int pixel_x = 0; pixel_x < qrcode_size; pixel_x++)
+        {
+            qrcode_row_ptr[pixel_x] = qrcode_data.getModule(pixel_x,pixel_y) == true ? improc::BaseDrawer::kBlackValue 
+                                                                                     : improc::BaseDrawer::kWhiteValue;
+        }
+    }
+}
+
+/**
+ * @brief Write modules of qr-code encoded with the built-in encoder in image, one pixel per module
+ * 
+ * @param qrcode_data - built-in encoder with the encoded qr-code
+ * @param roi - image with the size of the qr-code
+ */
+void improc::QrCodeDrawer::RasterizeQrCode(const improc::qrcode::QrCodeEncoder& qrcode_data, cv::Mat& roi)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Rasterizing qrcode...");
+    int qrcode_size = qrcode_data.get_size();
+    for (int pixel_y = 0; pixel_y < qrcode_size; pixel_y++)
+    {
+        auto qrcode_row_ptr = roi.ptr<uint8_t>(pixel_y);
+        for (int pixel_x = 0; pixel_x < qrcode_size; pixel_x++)
+        {
+            qrcode_row_ptr[pixel_x] = qrcode_data.GetModule(pixel_x,pixel_y) == true ? improc::BaseDrawer::kBlackValue 
+                                                                                     : improc::BaseDrawer::kWhiteValue;
+        }
+    }
+}
+
+/**
+ * @brief Verify message encoded in qr-code. 
+ * The raw bytes decoded from the qr-code are compared with the message text, so that byte payloads are 
+ * verified without any character set conversion.
  * 
  * @param drawer_output - qr-code image
  * @param message - message encoded in qr-code
  * @return bool - true if message and message recovered from the qr-code image is the same, false otherwise.
  */
-bool improc::QrCodeDrawer::Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message)
+bool improc::QrCodeDrawer::Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying qr-code content with {} effort...",this->verify_effort_.ToString());
+    if (this->verify_effort_ == improc::VerifyEffort::kPure)
+    {
+        ZXing::DecoderResult result = ZXing::QRCode::Decode(improc::QrCodeDrawer::BinarizeImage(drawer_output));
+        if (result.isValid() == false)
+        {
+            return false;
+        }
+        return improc::QrCodeDrawer::HasMessageBytes(result.content().bytes,this->GetMessageText(message));
+    }
+
+    static const ZXing::ReaderOptions kRobustOptions = ZXing::ReaderOptions().setFormats(ZXing::BarcodeFormat::QRCode).setTryHarder(true);
+    thread_local const ZXing::QRCode::Reader reader {kRobustOptions};
+    ZXing::Result result = reader.decode(ZXing::HybridBinarizer(ZXing::ImageView   ( drawer_output.data
+                                                                                    , drawer_output.cols
+                                                                                    , drawer_output.rows
+                                                                                    , improc::QrCodeDrawer::kImageFormat
+                                                                                    , static_cast<int>(drawer_output.step) )));
+    return result.isValid() == true && improc::QrCodeDrawer::HasMessageBytes(result.bytes(),this->GetMessageText(message));
+}
+
+/**
+ * @brief Check if bytes decoded from qr-code are the bytes of the message text
+ * 
+ * @param decoded_bytes - raw bytes decoded from qr-code
+ * @param message_text - text of message
+ * @return bool - true if decoded bytes and message text have the same bytes, false otherwise.
+ */
+bool improc::QrCodeDrawer::HasMessageBytes(const ZXing::ByteArray& decoded_bytes, std::string_view message_text)
+{
+    return std::equal   ( decoded_bytes.begin(),decoded_bytes.end(),message_text.begin(),message_text.end()
+                        , [] (uint8_t decoded_byte, char message_char) {return decoded_byte == static_cast<uint8_t>(message_char);} );
+}
+
+/**
+ * @brief Binarize qr-code image in a bit matrix kept per thread, reused while the image size does not change
+ * 
+ * @param drawer_output - qr-code image, possibly a region of a larger image
+ * @return const ZXing::BitMatrix& - bit matrix with the dark modules set, valid until the next call in the same thread
+ */
+const ZXing::BitMatrix& improc::QrCodeDrawer::BinarizeImage(const cv::Mat& drawer_output)
+{
+    thread_local ZXing::BitMatrix bit_matrix {};
+    if (bit_matrix.width() != drawer_output.cols || bit_matrix.height() != drawer_output.rows)
+    {
+        bit_matrix = ZXing::BitMatrix(drawer_output.cols,drawer_output.rows);
+    }
+    for (int pixel_y = 0; pixel_y < drawer_output.rows; pixel_y++)
+    {
+        const uint8_t* output_row_ptr = drawer_output.ptr<uint8_t>(pixel_y);
+        for (int pixel_x = 0; pixel_x < drawer_output.cols; pixel_x++)
+        {
+            bit_matrix.set(pixel_x,pixel_y,output_row_ptr[pixel_x] <= improc::QrCodeDrawer::kBlackThreshold);
+        }
+    }
+    return bit_matrix;
+}
+
+/**
+ * @brief Encode message in qr-code, within the version range and with the pinned mask whenever defined
+ * 
+ * @param message - message to be encoded in qr-code
+ * @return qrcodegen::QrCode - encoded qr-code
+ */
+qrcodegen::QrCode improc::QrCodeDrawer::Encode(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Encoding qrcode...");
+    return qrcodegen::QrCode::encodeSegments( this->MakeSegments(message),this->error_correction_level_.ToQrCodeGen()
+                                            , this->min_version_,this->max_version_,this->mask_.value_or(improc::QrCodeDrawer::kAutoMask) );
+}
+
+/**
+ * @brief Encode message in qr-code with the built-in encoder kept per thread, within the version range and with 
+ * the pinned mask whenever defined
+ * 
+ * @param message - message to be encoded in qr-code
+ * @return const improc::qrcode::QrCodeEncoder& - encoder with the encoded qr-code, valid until the next call in the same thread
+ */
+const improc::qrcode::QrCodeEncoder& improc::QrCodeDrawer::EncodeBuiltin(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Encoding qrcode with built-in encoder...");
+    thread_local improc::qrcode::QrCodeEncoder encoder {};
+    auto [segment_mode, segment_data] = this->GetSegment(message);
+    return encoder.Encode   ( segment_data,segment_mode,this->error_correction_level_.ToQrCodeGen()
+                            , this->min_version_,this->max_version_,this->mask_.value_or(improc::QrCodeDrawer::kAutoMask) );
+}
+
+/**
+ * @brief Obtain qrcodegen segments of message with the segment mode
+ * 
+ * @param message - message to be encoded in qr-code
+ * @return std::vector<qrcodegen::QrSegment> - qr-code segments of message
+ */
+std::vector<qrcodegen::QrSegment> improc::QrCodeDrawer::MakeSegments(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining qrcode segments with {} mode...",this->segment_mode_.ToString());
+    auto [segment_mode, segment_data] = this->GetSegment(message);
+    if (segment_mode == nullptr)
+    {
+        return {};
+    }
+    if (segment_mode == &qrcodegen::QrSegment::Mode::NUMERIC)
+    {
+        return {qrcodegen::QrSegment::makeNumeric(std::string(segment_data).c_str())};
+    }
+    if (segment_mode == &qrcodegen::QrSegment::Mode::ALPHANUMERIC)
+    {
+        return {qrcodegen::QrSegment::makeAlphanumeric(std::string(segment_data).c_str())};
+    }
+    return {qrcodegen::QrSegment::makeBytes(std::vector<uint8_t>(segment_data.begin(),segment_data.end()))};
+}
+
+/**
+ * @brief Obtain qr-code segment mode and segment characters of message, without copying the message text. 
+ * Byte payloads are encoded in a byte segment unless the segment mode is numeric or alphanumeric. Otherwise 
+ * the message text ends at its first null character and the automatic mode chooses a single segment, as done 
+ * by the qrcodegen encoder.
+ * 
+ * @param message - message to be encoded in qr-code
+ * @return std::pair<const qrcodegen::QrSegment::Mode*,std::string_view> - segment mode, nullptr for an empty message in automatic mode, and segment characters
+ */
+std::pair<const qrcodegen::QrSegment::Mode*,std::string_view> improc::QrCodeDrawer::GetSegment(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining qrcode segment with {} mode...",this->segment_mode_.ToString());
+    std::string_view message_text = this->GetMessageText(message);
+    if (this->segment_mode_ == improc::qrcode::SegmentMode::kByte 
+        || (this->segment_mode_ == improc::qrcode::SegmentMode::kAuto && std::holds_alternative<std::vector<std::byte>>(message.value()) == true))
+    {
+        return {&qrcodegen::QrSegment::Mode::BYTE,message_text};
+    }
+
+    message_text = message_text.substr(0,message_text.find('\0'));
+    bool is_numeric      = std::all_of(message_text.begin(),message_text.end(),[] (char message_char) {return '0' <= message_char && message_char <= '9';});
+    bool is_alphanumeric = message_text.find_first_not_of(kAlphanumericCharset) == std::string_view::npos;
+    if (this->segment_mode_ == improc::qrcode::SegmentMode::kAuto)
+    {
+        return {  message_text.empty() == true ? nullptr 
+                : is_numeric      == true      ? &qrcodegen::QrSegment::Mode::NUMERIC 
+                : is_alphanumeric == true      ? &qrcodegen::QrSegment::Mode::ALPHANUMERIC 
+                :                                &qrcodegen::QrSegment::Mode::BYTE
+               ,  message_text };
+    }
+    if (this->segment_mode_ == improc::qrcode::SegmentMode::kNumeric && is_numeric == true)
+    {
+        return {&qrcodegen::QrSegment::Mode::NUMERIC,message_text};
+    }
+    if (this->segment_mode_ == improc::qrcode::SegmentMode::kAlphanumeric && is_alphanumeric == true)
+    {
+        return {&qrcodegen::QrSegment::Mode::ALPHANUMERIC,message_text};
+    }
+    std::string error_message = fmt::format("Message cannot be encoded in qr-code with {} segment mode",this->segment_mode_.ToString());
+    IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+    throw improc::value_error(std::move(error_message));
+}
+
+/**
+ * @brief Obtain text of message. 
+ * Unsigned integer payloads are character indexes, in the numeric character set whenever every index fits it 
+ * and the segment mode is not alphanumeric, otherwise in the alphanumeric character set. With byte segment 
+ * mode, unsigned integer payloads are byte values. Payloads other than strings are converted in a buffer kept 
+ * per thread, reused while its capacity fits the payload.
+ * 
+ * @param message - message to be encoded in qr-code
+ * @return std::string_view - text of message, as decoded from the qr-code, valid until the next call in the same thread
+ */
+std::string_view improc::QrCodeDrawer::GetMessageText(const std::optional<improc::DrawerVariant>& message) const
 {
-    IMPROC_DRAWER_LOGGER_TRACE("Verifying qr-code content...");
-    std::unique_ptr<ZXing::BinaryBitmap> data_matrix_bitmap = 
-        std::make_unique<ZXing::ThresholdBinarizer> ( ZXing::ImageView  ( drawer_output.data
-                                                                        , drawer_output.cols
-                                                                        , drawer_output.rows
-                                                                        , improc::QrCodeDrawer::kImageFormat
-                                                    ), 0 );
-    ZXing::DecoderResult result = ZXing::QRCode::Decode(*(data_matrix_bitmap->getBitMatrix()));
-    if (result.isValid() == true)
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining qrcode message text...");
+    if (std::holds_alternative<std::string>(message.value()) == true)
+    {
+        return std::get<std::string>(message.value());
+    }
+    thread_local std::string message_text {};
+    if (std::holds_alternative<std::vector<std::byte>>(message.value()) == true)
+    {
+        const std::vector<std::byte>& payload = std::get<std::vector<std::byte>>(message.value());
+        message_text.resize(payload.size());
+        std::transform(payload.begin(),payload.end(),message_text.begin(),[] (std::byte value) {return static_cast<char>(value);});
+        return message_text;
+    }
+
+    const std::vector<unsigned int>& payload = std::get<std::vector<unsigned int>>(message.value());
+    unsigned int max_value = payload.empty() == true ? 0 : *std::max_element(payload.begin(),payload.end());
+    unsigned int charset_size = this->segment_mode_ == improc::qrcode::SegmentMode::kByte ? std::numeric_limits<uint8_t>::max() + 1 
+                              : this->segment_mode_ == improc::qrcode::SegmentMode::kNumeric ? kNumericCharsetSize 
+                              : this->segment_mode_ == improc::qrcode::SegmentMode::kAlphanumeric || max_value >= kNumericCharsetSize ? kAlphanumericCharset.size() 
+                              : kNumericCharsetSize;
+    if (payload.empty() == false && max_value >= charset_size)
     {
-        std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter {};
-        return converter.to_bytes(result.text()) == std::get<std::string>(message.value());
+        std::string error_message = fmt::format ( "Character index {} should be lower than the number of characters ({}) of {} segment mode"
+                                                , max_value, charset_size, this->segment_mode_.ToString() );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    message_text.resize(payload.size());
+    if (this->segment_mode_ == improc::qrcode::SegmentMode::kByte)
+    {
+        std::transform(payload.begin(),payload.end(),message_text.begin(),[] (unsigned int value) {return static_cast<char>(value);});
     }
     else
     {
-        return false;
+        std::transform(payload.begin(),payload.end(),message_text.begin(),[] (unsigned int value) {return kAlphanumericCharset[value];});
     }
-}
\ No newline at end of file
+    return message_text;
+}
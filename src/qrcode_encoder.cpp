@@ -0,0 +1,854 @@
+#include <improc/drawer/drawer_types/qrcode_encoder.hpp>
+
+namespace
+{
+    /**
+     * @brief Number of error correction codewords per block, indexed by error correction level and qr-code version
+     */
+    constexpr int kEccCodewordsPerBlock[4][41] = 
+        { {-1,  7, 10, 15, 20, 26, 18, 20, 24, 30, 18, 20, 24, 26, 30, 22, 24, 28, 30, 28, 28, 28, 28, 30, 30, 26, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30}
+        , {-1, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26, 30, 22, 22, 24, 24, 28, 28, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28}
+        , {-1, 13, 22, 18, 26, 18, 24, 18, 22, 20, 24, 28, 26, 24, 20, 30, 24, 28, 28, 26, 30, 28, 30, 30, 30, 30, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30}
+        , {-1, 17, 28, 22, 16, 22, 28, 26, 26, 24, 28, 24, 28, 22, 24, 24, 30, 28, 28, 26, 28, 30, 24, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30} };
+
+    /**
+     * @brief Number of error correction blocks, indexed by error correction level and qr-code version
+     */
+    constexpr int kNumErrorCorrectionBlocks[4][41] = 
+        { {-1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 4,  4,  4,  4,  4,  6,  6,  6,  6,  7,  8,  8,  9,  9, 10, 12, 12, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 24, 25}
+        , {-1, 1, 1, 1, 2, 2, 4, 4, 4, 5, 5,  5,  8,  9,  9, 10, 10, 11, 13, 14, 16, 17, 17, 18, 20, 21, 23, 25, 26, 28, 29, 31, 33, 35, 37, 38, 40, 43, 45, 47, 49}
+        , {-1, 1, 1, 2, 2, 4, 4, 6, 6, 8, 8,  8, 10, 12, 16, 12, 17, 16, 18, 21, 20, 23, 23, 25, 27, 29, 34, 34, 35, 38, 40, 43, 45, 48, 51, 53, 56, 59, 62, 65, 68}
+        , {-1, 1, 1, 2, 4, 4, 4, 5, 6, 8, 8, 11, 11, 16, 16, 18, 16, 19, 21, 25, 25, 25, 34, 30, 32, 35, 37, 40, 42, 45, 48, 51, 54, 57, 60, 63, 66, 70, 74, 77, 81} };
+
+    /**
+     * @brief Characters of the qr-code alphanumeric mode, indexed by character value
+     */
+    constexpr std::string_view kAlphanumericCharset = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+
+    /**
+     * @brief Maximum number of error correction codewords per block
+     */
+    constexpr int kMaxBlockEccLength = 30;
+
+    /**
+     * @brief Multiplication table of GF(256), indexed by both factors
+     */
+    typedef std::array<std::array<uint8_t,256>,256> GaloisMultiplyTable;
+
+    /**
+     * @brief Reed-Solomon generator polynomials, indexed by degree, with the leading term omitted
+     */
+    typedef std::array<std::array<uint8_t,kMaxBlockEccLength>,kMaxBlockEccLength + 1> ReedSolomonDivisors;
+
+    /**
+     * @brief Obtain multiplication table of GF(256) modulo x^8 + x^4 + x^3 + x^2 + 1
+     */
+    const GaloisMultiplyTable& GetGaloisMultiplyTable()
+    {
+        static const GaloisMultiplyTable kMultiplyTable = [] ()
+        {
+            std::array<uint8_t,510> exponentials {};
+            std::array<int,256>     logarithms  {};
+            int value = 1;
+            for (int exponent = 0; exponent < 255; exponent++)
+            {
+                exponentials[exponent]       = static_cast<uint8_t>(value);
+                exponentials[exponent + 255] = static_cast<uint8_t>(value);
+                logarithms[value] = exponent;
+                value = (value << 1) ^ ((value >> 7) * 0x11D);
+            }
+            GaloisMultiplyTable multiply_table {};
+            for (int factor_x = 1; factor_x < 256; factor_x++)
+            {
+                for (int factor_y = 1; factor_y < 256; factor_y++)
+                {
+                    multiply_table[factor_x][factor_y] = exponentials[logarithms[factor_x] + logarithms[factor_y]];
+                }
+            }
+            return multiply_table;
+        }();
+        return kMultiplyTable;
+    }
+
+    /**
+     * @brief Obtain Reed-Solomon generator polynomials of every degree used by qr-codes
+     */
+    const ReedSolomonDivisors& GetReedSolomonDivisors()
+    {
+        static const ReedSolomonDivisors kDivisors = [] ()
+        {
+            const GaloisMultiplyTable& multiply_table = GetGaloisMultiplyTable();
+            ReedSolomonDivisors divisors {};
+            for (int degree = 1; degree <= kMaxBlockEccLength; degree++)
+            {
+                std::array<uint8_t,kMaxBlockEccLength>& divisor = divisors[degree];
+                divisor[degree - 1] = 1;
+                uint8_t root = 1;
+                for (int root_idx = 0; root_idx < degree; root_idx++)
+                {
+                    for (int coeff_idx = 0; coeff_idx < degree; coeff_idx++)
+                    {
+                        divisor[coeff_idx] = multiply_table[divisor[coeff_idx]][root];
+                        if (coeff_idx + 1 < degree)
+                        {
+                            divisor[coeff_idx] ^= divisor[coeff_idx + 1];
+                        }
+                    }
+                    root = multiply_table[root][0x02];
+                }
+            }
+            return divisors;
+        }();
+        return kDivisors;
+    }
+
+    /**
+     * @brief Obtain number of bits set in a word
+     */
+    inline int CountBits(uint64_t word)
+    {
+        return static_cast<int>(std::bitset<64>(word).count());
+    }
+}
+
+/**
+ * @brief Construct a new improc::qrcode::QrCodeEncoder object
+ */
+improc::qrcode::QrCodeEncoder::QrCodeEncoder()  : version_(0)
+                                                , size_(0)
+                                                , mask_(0)
+                                                , error_correction_level_(qrcodegen::QrCode::Ecc::LOW)
+                                                , valid_modules_()
+                                                , rows_()
+                                                , columns_()
+                                                , function_rows_()
+                                                , function_columns_()
+                                                , data_codewords_()
+                                                , codewords_() {};
+
+/**
+ * @brief Encode a single segment message in qr-code. 
+ * The version is the smallest version of the version range that fits the segment, the error correction level 
+ * is boosted while the segment still fits the version and the mask with the lowest penalty score is chosen 
+ * unless a mask is given, as done by the qrcodegen encoder.
+ * 
+ * @param segment_data - characters of segment, digits for numeric mode and alphanumeric characters for alphanumeric mode
+ * @param segment_mode - qrcodegen mode of segment, nullptr for a message without segments
+ * @param error_correction_level - minimum error correction level
+ * @param min_version - minimum qr-code version
+ * @param max_version - maximum qr-code version
+ * @param mask - qr-code mask between 0 and 7, or -1 to choose the mask by penalty score
+ * @return QrCodeEncoder& - encoder with the encoded qr-code
+ */
+improc::qrcode::QrCodeEncoder& improc::qrcode::QrCodeEncoder::Encode ( std::string_view segment_data, const qrcodegen::QrSegment::Mode* segment_mode
+                                                                     , qrcodegen::QrCode::Ecc error_correction_level, int min_version, int max_version, int mask )
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Encoding qr-code with built-in encoder...");
+    if (   min_version < qrcodegen::QrCode::MIN_VERSION || max_version > qrcodegen::QrCode::MAX_VERSION || min_version > max_version
+        || mask < improc::qrcode::QrCodeEncoder::kAutoMask || mask >= improc::qrcode::QrCodeEncoder::kNumberMasks )
+    {
+        std::string error_message = fmt::format("Invalid qr-code version range [{},{}] or mask {}",min_version,max_version,mask);
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    int version        = min_version;
+    int data_used_bits = 0;
+    for (version = min_version; ; version++)
+    {
+        data_used_bits = improc::qrcode::QrCodeEncoder::GetTotalBits(segment_data,segment_mode,version);
+        if (data_used_bits != -1 && data_used_bits <= improc::qrcode::QrCodeEncoder::GetNumDataCodewords(version,error_correction_level) * 8)
+        {
+            break;
+        }
+        if (version >= max_version)
+        {
+            std::string error_message = "Message too long to be encoded in qr-code";
+            IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+            throw qrcodegen::data_too_long(std::move(error_message));
+        }
+    }
+    for (qrcodegen::QrCode::Ecc boosted_level : {qrcodegen::QrCode::Ecc::MEDIUM,qrcodegen::QrCode::Ecc::QUARTILE,qrcodegen::QrCode::Ecc::HIGH})
+    {
+        if (data_used_bits <= improc::qrcode::QrCodeEncoder::GetNumDataCodewords(version,boosted_level) * 8)
+        {
+            error_correction_level = boosted_level;
+        }
+    }
+    this->version_                = version;
+    this->size_                   = version * 4 + 17;
+    this->error_correction_level_ = error_correction_level;
+    this->WriteDataCodewords(segment_data,segment_mode);
+    this->AddErrorCorrection();
+
+    this->valid_modules_.fill(0);
+    for (int module_idx = 0; module_idx < this->size_; module_idx++)
+    {
+        this->valid_modules_[module_idx / kWordBits] |= uint64_t(1) << (module_idx % kWordBits);
+        this->rows_[module_idx].fill(0);
+        this->columns_[module_idx].fill(0);
+        this->function_rows_[module_idx].fill(0);
+        this->function_columns_[module_idx].fill(0);
+    }
+    this->DrawFunctionPatterns();
+    this->DrawCodewords();
+    if (mask == improc::qrcode::QrCodeEncoder::kAutoMask)
+    {
+        long min_penalty = LONG_MAX;
+        for (int mask_idx = 0; mask_idx < improc::qrcode::QrCodeEncoder::kNumberMasks; mask_idx++)
+        {
+            this->ApplyMask(mask_idx);
+            this->DrawFormatBits(mask_idx);
+            long penalty = this->GetPenaltyScore();
+            if (penalty < min_penalty)
+            {
+                mask        = mask_idx;
+                min_penalty = penalty;
+            }
+            this->ApplyMask(mask_idx);
+        }
+    }
+    this->mask_ = mask;
+    this->ApplyMask(mask);
+    this->DrawFormatBits(mask);
+    return (*this);
+}
+
+/**
+ * @brief Obtain number of bits of a single segment message, including mode and character count indicators
+ * 
+ * @param segment_data - characters of segment
+ * @param segment_mode - qrcodegen mode of segment, nullptr for a message without segments
+ * @param version - qr-code version
+ * @return int - number of bits, -1 if the number of characters does not fit the character count indicator
+ */
+int improc::qrcode::QrCodeEncoder::GetTotalBits(std::string_view segment_data, const qrcodegen::QrSegment::Mode* segment_mode, int version)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining qr-code segment bits...");
+    if (segment_mode == nullptr)
+    {
+        return 0;
+    }
+    int char_count_bits = segment_mode->numCharCountBits(version);
+    int num_chars       = static_cast<int>(segment_data.size());
+    if (num_chars >= (1 << char_count_bits))
+    {
+        return -1;
+    }
+    int data_bits = num_chars * 8;
+    if (segment_mode == &qrcodegen::QrSegment::Mode::NUMERIC)
+    {
+        data_bits = num_chars / 3 * 10 + (num_chars % 3 == 0 ? 0 : num_chars % 3 * 3 + 1);
+    }
+    else if (segment_mode == &qrcodegen::QrSegment::Mode::ALPHANUMERIC)
+    {
+        data_bits = num_chars / 2 * 11 + num_chars % 2 * 6;
+    }
+    return 4 + char_count_bits + data_bits;
+}
+
+/**
+ * @brief Obtain number of data codewords of a qr-code version, excluding error correction codewords
+ * 
+ * @param version - qr-code version between 1 and 40
+ * @param error_correction_level - qr-code error correction level
+ * @return int - number of data codewords
+ */
+int improc::qrcode::QrCodeEncoder::GetNumDataCodewords(int version, qrcodegen::QrCode::Ecc error_correction_level)
+{
+    int level = static_cast<int>(error_correction_level);
+    return improc::qrcode::QrCodeEncoder::GetNumRawDataModules(version) / 8 - kEccCodewordsPerBlock[level][version] * kNumErrorCorrectionBlocks[level][version];
+}
+
+/**
+ * @brief Obtain number of modules available for data and error correction codewords, including remainder bits
+ * 
+ * @param version - qr-code version between 1 and 40
+ * @return int - number of data modules
+ */
+int improc::qrcode::QrCodeEncoder::GetNumRawDataModules(int version)
+{
+    int num_raw_modules = (16 * version + 128) * version + 64;
+    if (version >= 2)
+    {
+        int num_alignment = version / 7 + 2;
+        num_raw_modules  -= (25 * num_alignment - 10) * num_alignment - 55;
+        if (version >= 7)
+        {
+            num_raw_modules -= 36;
+        }
+    }
+    return num_raw_modules;
+}
+
+/**
+ * @brief Write segment, terminator and padding bytes in data codewords
+ * 
+ * @param segment_data - characters of segment
+ * @param segment_mode - qrcodegen mode of segment, nullptr for a message without segments
+ */
+void improc::qrcode::QrCodeEncoder::WriteDataCodewords(std::string_view segment_data, const qrcodegen::QrSegment::Mode* segment_mode)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Writing qr-code data codewords...");
+    int data_capacity_bits = improc::qrcode::QrCodeEncoder::GetNumDataCodewords(this->version_,this->error_correction_level_) * 8;
+    std::fill_n(this->data_codewords_.begin(),data_capacity_bits / 8,0);
+    int bit_idx = 0;
+    auto append_bits = [this,&bit_idx] (uint32_t value, int num_bits)
+    {
+        for (int value_bit_idx = num_bits - 1; value_bit_idx >= 0; value_bit_idx--, bit_idx++)
+        {
+            this->data_codewords_[bit_idx >> 3] |= static_cast<uint8_t>(((value >> value_bit_idx) & 1U) << (7 - (bit_idx & 7)));
+        }
+    };
+
+    if (segment_mode != nullptr)
+    {
+        append_bits(static_cast<uint32_t>(segment_mode->getModeBits()),4);
+        append_bits(static_cast<uint32_t>(segment_data.size()),segment_mode->numCharCountBits(this->version_));
+        uint32_t accum_data  = 0;
+        int      accum_count = 0;
+        for (char segment_char : segment_data)
+        {
+            if (segment_mode == &qrcodegen::QrSegment::Mode::NUMERIC)
+            {
+                accum_data = accum_data * 10 + static_cast<uint32_t>(segment_char - '0');
+                if (++accum_count == 3)
+                {
+                    append_bits(accum_data,10);
+                    accum_data  = 0;
+                    accum_count = 0;
+                }
+            }
+            else if (segment_mode == &qrcodegen::QrSegment::Mode::ALPHANUMERIC)
+            {
+                accum_data = accum_data * 45 + static_cast<uint32_t>(kAlphanumericCharset.find(segment_char));
+                if (++accum_count == 2)
+                {
+                    append_bits(accum_data,11);
+                    accum_data  = 0;
+                    accum_count = 0;
+                }
+            }
+            else
+            {
+                append_bits(static_cast<uint8_t>(segment_char),8);
+            }
+        }
+        if (accum_count > 0)
+        {
+            append_bits(accum_data,segment_mode == &qrcodegen::QrSegment::Mode::NUMERIC ? accum_count * 3 + 1 : 6);
+        }
+    }
+    bit_idx += std::min(4,data_capacity_bits - bit_idx);
+    bit_idx += (8 - bit_idx % 8) % 8;
+    for (uint8_t pad_byte = 0xEC; bit_idx < data_capacity_bits; pad_byte ^= 0xEC ^ 0x11)
+    {
+        append_bits(pad_byte,8);
+    }
+}
+
+/**
+ * @brief Compute error correction codewords of every block and interleave them with the data codewords
+ */
+void improc::qrcode::QrCodeEncoder::AddErrorCorrection()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Adding qr-code error correction...");
+    int level            = static_cast<int>(this->error_correction_level_);
+    int num_blocks       = kNumErrorCorrectionBlocks[level][this->version_];
+    int block_ecc_length = kEccCodewordsPerBlock[level][this->version_];
+    int raw_codewords    = improc::qrcode::QrCodeEncoder::GetNumRawDataModules(this->version_) / 8;
+    int num_short_blocks = num_blocks - raw_codewords % num_blocks;
+    int short_data_length = raw_codewords / num_blocks - block_ecc_length;
+    int data_length      = raw_codewords - block_ecc_length * num_blocks;
+
+    const GaloisMultiplyTable& multiply_table = GetGaloisMultiplyTable();
+    const std::array<uint8_t,kMaxBlockEccLength>& divisor = GetReedSolomonDivisors()[block_ecc_length];
+    std::array<uint8_t,kMaxBlockEccLength> remainder {};
+    for (int block_idx = 0, data_idx = 0; block_idx < num_blocks; block_idx++)
+    {
+        int block_data_length = short_data_length + (block_idx < num_short_blocks ? 0 : 1);
+        remainder.fill(0);
+        for (int block_data_idx = 0; block_data_idx < block_data_length; block_data_idx++, data_idx++)
+        {
+            uint8_t data_codeword = this->data_codewords_[data_idx];
+            int interleaved_idx   = block_data_idx < short_data_length ? block_data_idx * num_blocks + block_idx 
+                                                                       : short_data_length * num_blocks + block_idx - num_short_blocks;
+            this->codewords_[interleaved_idx] = data_codeword;
+
+            const std::array<uint8_t,256>& factor_products = multiply_table[data_codeword ^ remainder[0]];
+            std::copy(remainder.begin() + 1,remainder.begin() + block_ecc_length,remainder.begin());
+            remainder[block_ecc_length - 1] = 0;
+            for (int coeff_idx = 0; coeff_idx < block_ecc_length; coeff_idx++)
+            {
+                remainder[coeff_idx] ^= factor_products[divisor[coeff_idx]];
+            }
+        }
+        for (int ecc_idx = 0; ecc_idx < block_ecc_length; ecc_idx++)
+        {
+            this->codewords_[data_length + ecc_idx * num_blocks + block_idx] = remainder[ecc_idx];
+        }
+    }
+}
+
+/**
+ * @brief Draw timing, finder and alignment patterns, a placeholder for format bits and version bits
+ */
+void improc::qrcode::QrCodeEncoder::DrawFunctionPatterns()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing qr-code function patterns...");
+    for (int module_idx = 0; module_idx < this->size_; module_idx++)
+    {
+        this->SetFunctionModule(6,module_idx,module_idx % 2 == 0);
+        this->SetFunctionModule(module_idx,6,module_idx % 2 == 0);
+    }
+    this->DrawFinderPattern(3,3);
+    this->DrawFinderPattern(this->size_ - 4,3);
+    this->DrawFinderPattern(3,this->size_ - 4);
+
+    if (this->version_ > 1)
+    {
+        std::array<int,7> alignment_positions {};
+        int num_alignment = this->version_ / 7 + 2;
+        int step          = (this->version_ * 8 + num_alignment * 3 + 5) / (num_alignment * 4 - 4) * 2;
+        alignment_positions[0] = 6;
+        for (int align_idx = num_alignment - 1, position = this->size_ - 7; align_idx >= 1; align_idx--, position -= step)
+        {
+            alignment_positions[align_idx] = position;
+        }
+        for (int align_y = 0; align_y < num_alignment; align_y++)
+        {
+            for (int align_x = 0; align_x < num_alignment; align_x++)
+            {
+                if ((align_x == 0 && align_y == 0) || (align_x == 0 && align_y == num_alignment - 1) || (align_x == num_alignment - 1 && align_y == 0))
+                {
+                    continue;
+                }
+                this->DrawAlignmentPattern(alignment_positions[align_x],alignment_positions[align_y]);
+            }
+        }
+    }
+    this->DrawFormatBits(0);
+    this->DrawVersion();
+}
+
+/**
+ * @brief Draw finder pattern with its separator
+ * 
+ * @param center_x - module column of finder pattern center
+ * @param center_y - module row of finder pattern center
+ */
+void improc::qrcode::QrCodeEncoder::DrawFinderPattern(int center_x, int center_y)
+{
+    for (int delta_y = -4; delta_y <= 4; delta_y++)
+    {
+        for (int delta_x = -4; delta_x <= 4; delta_x++)
+        {
+            int distance = std::max(std::abs(delta_x),std::abs(delta_y));
+            int module_x = center_x + delta_x;
+            int module_y = center_y + delta_y;
+            if (0 <= module_x && module_x < this->size_ && 0 <= module_y && module_y < this->size_)
+            {
+                this->SetFunctionModule(module_x,module_y,distance != 2 && distance != 4);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Draw alignment pattern
+ * 
+ * @param center_x - module column of alignment pattern center
+ * @param center_y - module row of alignment pattern center
+ */
+void improc::qrcode::QrCodeEncoder::DrawAlignmentPattern(int center_x, int center_y)
+{
+    for (int delta_y = -2; delta_y <= 2; delta_y++)
+    {
+        for (int delta_x = -2; delta_x <= 2; delta_x++)
+        {
+            this->SetFunctionModule(center_x + delta_x,center_y + delta_y,std::max(std::abs(delta_x),std::abs(delta_y)) != 1);
+        }
+    }
+}
+
+/**
+ * @brief Draw both copies of the format bits, with the error correction level and the mask
+ * 
+ * @param mask - qr-code mask between 0 and 7
+ */
+void improc::qrcode::QrCodeEncoder::DrawFormatBits(int mask)
+{
+    static constexpr int kFormatLevelBits[4] = {1, 0, 3, 2};
+    int format_data = kFormatLevelBits[static_cast<int>(this->error_correction_level_)] << 3 | mask;
+    int remainder   = format_data;
+    for (int bit_idx = 0; bit_idx < 10; bit_idx++)
+    {
+        remainder = (remainder << 1) ^ ((remainder >> 9) * 0x537);
+    }
+    int format_bits = (format_data << 10 | remainder) ^ 0x5412;
+    auto get_bit = [format_bits] (int bit_idx) {return ((format_bits >> bit_idx) & 1) != 0;};
+
+    for (int bit_idx = 0; bit_idx <= 5; bit_idx++)
+    {
+        this->SetFunctionModule(8,bit_idx,get_bit(bit_idx));
+    }
+    this->SetFunctionModule(8,7,get_bit(6));
+    this->SetFunctionModule(8,8,get_bit(7));
+    this->SetFunctionModule(7,8,get_bit(8));
+    for (int bit_idx = 9; bit_idx < 15; bit_idx++)
+    {
+        this->SetFunctionModule(14 - bit_idx,8,get_bit(bit_idx));
+    }
+    for (int bit_idx = 0; bit_idx < 8; bit_idx++)
+    {
+        this->SetFunctionModule(this->size_ - 1 - bit_idx,8,get_bit(bit_idx));
+    }
+    for (int bit_idx = 8; bit_idx < 15; bit_idx++)
+    {
+        this->SetFunctionModule(8,this->size_ - 15 + bit_idx,get_bit(bit_idx));
+    }
+    this->SetFunctionModule(8,this->size_ - 8,true);
+}
+
+/**
+ * @brief Draw both copies of the version bits, for versions 7 and above
+ */
+void improc::qrcode::QrCodeEncoder::DrawVersion()
+{
+    if (this->version_ < 7)
+    {
+        return;
+    }
+    int remainder = this->version_;
+    for (int bit_idx = 0; bit_idx < 12; bit_idx++)
+    {
+        remainder = (remainder << 1) ^ ((remainder >> 11) * 0x1F25);
+    }
+    long version_bits = static_cast<long>(this->version_) << 12 | remainder;
+    for (int bit_idx = 0; bit_idx < 18; bit_idx++)
+    {
+        bool is_dark  = ((version_bits >> bit_idx) & 1) != 0;
+        int  module_a = this->size_ - 11 + bit_idx % 3;
+        int  module_b = bit_idx / 3;
+        this->SetFunctionModule(module_a,module_b,is_dark);
+        this->SetFunctionModule(module_b,module_a,is_dark);
+    }
+}
+
+/**
+ * @brief Draw interleaved codewords in the data modules, following the zigzag placement of qr-codes
+ */
+void improc::qrcode::QrCodeEncoder::DrawCodewords()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing qr-code codewords...");
+    int num_bits = improc::qrcode::QrCodeEncoder::GetNumRawDataModules(this->version_) / 8 * 8;
+    int bit_idx  = 0;
+    for (int right = this->size_ - 1; right >= 1; right -= 2)
+    {
+        if (right == 6)
+        {
+            right = 5;
+        }
+        bool is_upward = ((right + 1) & 2) == 0;
+        for (int vert = 0; vert < this->size_; vert++)
+        {
+            int module_y = is_upward == true ? this->size_ - 1 - vert : vert;
+            for (int module_x = right; module_x >= right - 1; module_x--)
+            {
+                if (((this->function_rows_[module_y][module_x / kWordBits] >> (module_x % kWordBits)) & 1U) != 0 || bit_idx >= num_bits)
+                {
+                    continue;
+                }
+                if (((this->codewords_[bit_idx >> 3] >> (7 - (bit_idx & 7))) & 1) != 0)
+                {
+                    this->rows_[module_y][module_x / kWordBits]    |= uint64_t(1) << (module_x % kWordBits);
+                    this->columns_[module_x][module_y / kWordBits] |= uint64_t(1) << (module_y % kWordBits);
+                }
+                bit_idx++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Invert the data modules selected by a mask. Applying the same mask twice undoes it.
+ * 
+ * @param mask - qr-code mask between 0 and 7
+ */
+void improc::qrcode::QrCodeEncoder::ApplyMask(int mask)
+{
+    const improc::qrcode::QrCodeEncoder::MaskTable& mask_rows    = improc::qrcode::QrCodeEncoder::GetMaskRows();
+    const improc::qrcode::QrCodeEncoder::MaskTable& mask_columns = improc::qrcode::QrCodeEncoder::GetMaskColumns();
+    for (int line_idx = 0; line_idx < this->size_; line_idx++)
+    {
+        for (int word_idx = 0; word_idx < kLineWords; word_idx++)
+        {
+            this->rows_[line_idx][word_idx]    ^= mask_rows[mask][line_idx % kMaskPeriod][word_idx]    & ~this->function_rows_[line_idx][word_idx]    & this->valid_modules_[word_idx];
+            this->columns_[line_idx][word_idx] ^= mask_columns[mask][line_idx % kMaskPeriod][word_idx] & ~this->function_columns_[line_idx][word_idx] & this->valid_modules_[word_idx];
+        }
+    }
+}
+
+/**
+ * @brief Set color of a function module, in both rows and columns
+ * 
+ * @param module_x - module column
+ * @param module_y - module row
+ * @param is_dark - module color
+ */
+void improc::qrcode::QrCodeEncoder::SetFunctionModule(int module_x, int module_y, bool is_dark)
+{
+    uint64_t row_bit    = uint64_t(1) << (module_x % kWordBits);
+    uint64_t column_bit = uint64_t(1) << (module_y % kWordBits);
+    if (is_dark == true)
+    {
+        this->rows_[module_y][module_x / kWordBits]    |= row_bit;
+        this->columns_[module_x][module_y / kWordBits] |= column_bit;
+    }
+    else
+    {
+        this->rows_[module_y][module_x / kWordBits]    &= ~row_bit;
+        this->columns_[module_x][module_y / kWordBits] &= ~column_bit;
+    }
+    this->function_rows_[module_y][module_x / kWordBits]    |= row_bit;
+    this->function_columns_[module_x][module_y / kWordBits] |= column_bit;
+}
+
+/**
+ * @brief Obtain penalty score of the current modules, as defined by the qr-code standard. 
+ * Runs are found one word at a time and 2x2 blocks are counted with word operations over pairs of rows.
+ * 
+ * @return long - penalty score
+ */
+long improc::qrcode::QrCodeEncoder::GetPenaltyScore() const
+{
+    long penalty = 0;
+    for (int line_idx = 0; line_idx < this->size_; line_idx++)
+    {
+        penalty += this->GetLinePenalty(this->rows_[line_idx]);
+        penalty += this->GetLinePenalty(this->columns_[line_idx]);
+    }
+
+    improc::qrcode::QrCodeEncoder::ModuleLine block_modules {};
+    for (int module_idx = 0; module_idx < this->size_ - 1; module_idx++)
+    {
+        block_modules[module_idx / kWordBits] |= uint64_t(1) << (module_idx % kWordBits);
+    }
+    auto shift_line = [] (const improc::qrcode::QrCodeEncoder::ModuleLine& line, int word_idx) 
+    {
+        return (line[word_idx] >> 1) | (word_idx + 1 < kLineWords ? line[word_idx + 1] << (kWordBits - 1) : 0);
+    };
+    int num_blocks = 0;
+    for (int module_y = 0; module_y < this->size_ - 1; module_y++)
+    {
+        const improc::qrcode::QrCodeEncoder::ModuleLine& top_row    = this->rows_[module_y];
+        const improc::qrcode::QrCodeEncoder::ModuleLine& bottom_row = this->rows_[module_y + 1];
+        for (int word_idx = 0; word_idx < kLineWords; word_idx++)
+        {
+            uint64_t same_left  = ~(top_row[word_idx] ^ bottom_row[word_idx]);
+            uint64_t same_right = ~(shift_line(top_row,word_idx) ^ shift_line(bottom_row,word_idx));
+            uint64_t same_top   = ~(top_row[word_idx] ^ shift_line(top_row,word_idx));
+            num_blocks += CountBits(same_left & same_right & same_top & block_modules[word_idx]);
+        }
+    }
+    penalty += num_blocks * improc::qrcode::QrCodeEncoder::kPenaltyN2;
+
+    long num_dark = 0;
+    for (int module_y = 0; module_y < this->size_; module_y++)
+    {
+        for (int word_idx = 0; word_idx < kLineWords; word_idx++)
+        {
+            num_dark += CountBits(this->rows_[module_y][word_idx]);
+        }
+    }
+    long num_total = static_cast<long>(this->size_) * this->size_;
+    int  balance   = static_cast<int>((std::abs(num_dark * 20L - num_total * 10L) + num_total - 1) / num_total) - 1;
+    penalty += balance * improc::qrcode::QrCodeEncoder::kPenaltyN4;
+    return penalty;
+}
+
+/**
+ * @brief Obtain penalty score of runs and finder-like patterns in a row or column
+ * 
+ * @param line - modules of row or column
+ * @return long - penalty score of line
+ */
+long improc::qrcode::QrCodeEncoder::GetLinePenalty(const improc::qrcode::QrCodeEncoder::ModuleLine& line) const
+{
+    long penalty = 0;
+    bool run_color  = false;
+    int  run_length = 0;
+    std::array<int,7> run_history {};
+    for (int module_idx = 0; module_idx < this->size_; )
+    {
+        bool module_color = ((line[module_idx / kWordBits] >> (module_idx % kWordBits)) & 1U) != 0;
+        int  next_run_idx = this->GetNextRunStart(line,module_idx,module_color);
+        if (module_color != run_color)
+        {
+            this->AddRunHistory(run_length,run_history);
+            if (run_color == false)
+            {
+                penalty += improc::qrcode::QrCodeEncoder::CountFinderPatterns(run_history) * improc::qrcode::QrCodeEncoder::kPenaltyN3;
+            }
+            run_color  = module_color;
+            run_length = 0;
+        }
+        run_length += next_run_idx - module_idx;
+        if (run_length >= 5)
+        {
+            penalty += improc::qrcode::QrCodeEncoder::kPenaltyN1 + run_length - 5;
+        }
+        module_idx = next_run_idx;
+    }
+    if (run_color == true)
+    {
+        this->AddRunHistory(run_length,run_history);
+        run_length = 0;
+    }
+    this->AddRunHistory(run_length + this->size_,run_history);
+    penalty += improc::qrcode::QrCodeEncoder::CountFinderPatterns(run_history) * improc::qrcode::QrCodeEncoder::kPenaltyN3;
+    return penalty;
+}
+
+/**
+ * @brief Obtain index of the first module of a line, at or after a given module, with a different color
+ * 
+ * @param line - modules of row or column
+ * @param module_idx - index of first module of run
+ * @param is_dark - color of run
+ * @return int - index of first module after the run, or the qr-code size if the run reaches the end of the line
+ */
+int improc::qrcode::QrCodeEncoder::GetNextRunStart(const improc::qrcode::QrCodeEncoder::ModuleLine& line, int module_idx, bool is_dark) const
+{
+    int      word_idx = module_idx / kWordBits;
+    uint64_t changes  = (is_dark == true ? ~line[word_idx] : line[word_idx]) & (~uint64_t(0) << (module_idx % kWordBits));
+    while (changes == 0)
+    {
+        if (++word_idx == kLineWords)
+        {
+            return this->size_;
+        }
+        changes = is_dark == true ? ~line[word_idx] : line[word_idx];
+    }
+    return std::min(word_idx * kWordBits + improc::qrcode::QrCodeEncoder::CountTrailingZeros(changes),this->size_);
+}
+
+/**
+ * @brief Push run length in run history, adding the light border to the first run
+ * 
+ * @param run_length - length of finished run
+ * @param run_history - lengths of the last 7 runs, most recent first
+ */
+void improc::qrcode::QrCodeEncoder::AddRunHistory(int run_length, std::array<int,7>& run_history) const
+{
+    if (run_history[0] == 0)
+    {
+        run_length += this->size_;
+    }
+    std::copy_backward(run_history.begin(),run_history.end() - 1,run_history.end());
+    run_history[0] = run_length;
+}
+
+/**
+ * @brief Count finder-like patterns ending at the most recent light run of the run history
+ * 
+ * @param run_history - lengths of the last 7 runs, most recent first
+ * @return int - number of finder-like patterns, between 0 and 2
+ */
+int improc::qrcode::QrCodeEncoder::CountFinderPatterns(const std::array<int,7>& run_history)
+{
+    int  run_unit = run_history[1];
+    bool is_core  = run_unit > 0 && run_history[2] == run_unit && run_history[3] == run_unit * 3 && run_history[4] == run_unit && run_history[5] == run_unit;
+    return (is_core == true && run_history[0] >= run_unit * 4 && run_history[6] >= run_unit ? 1 : 0)
+         + (is_core == true && run_history[6] >= run_unit * 4 && run_history[0] >= run_unit ? 1 : 0);
+}
+
+/**
+ * @brief Obtain number of trailing zero bits of a non zero word
+ */
+int improc::qrcode::QrCodeEncoder::CountTrailingZeros(uint64_t word)
+{
+#if defined(_MSC_VER)
+    unsigned long bit_idx = 0;
+    _BitScanForward64(&bit_idx,word);
+    return static_cast<int>(bit_idx);
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+/**
+ * @brief Obtain rows of every mask, indexed by mask and row modulo the mask period
+ */
+const improc::qrcode::QrCodeEncoder::MaskTable& improc::qrcode::QrCodeEncoder::GetMaskRows()
+{
+    static const improc::qrcode::QrCodeEncoder::MaskTable kMaskRows = [] ()
+    {
+        improc::qrcode::QrCodeEncoder::MaskTable mask_rows {};
+        for (int mask = 0; mask < kNumberMasks; mask++)
+        {
+            for (int module_y = 0; module_y < kMaskPeriod; module_y++)
+            {
+                for (int module_x = 0; module_x < kLineWords * kWordBits; module_x++)
+                {
+                    if (improc::qrcode::QrCodeEncoder::IsMaskedModule(mask,module_x,module_y) == true)
+                    {
+                        mask_rows[mask][module_y][module_x / kWordBits] |= uint64_t(1) << (module_x % kWordBits);
+                    }
+                }
+            }
+        }
+        return mask_rows;
+    }();
+    return kMaskRows;
+}
+
+/**
+ * @brief Obtain columns of every mask, indexed by mask and column modulo the mask period
+ */
+const improc::qrcode::QrCodeEncoder::MaskTable& improc::qrcode::QrCodeEncoder::GetMaskColumns()
+{
+    static const improc::qrcode::QrCodeEncoder::MaskTable kMaskColumns = [] ()
+    {
+        improc::qrcode::QrCodeEncoder::MaskTable mask_columns {};
+        for (int mask = 0; mask < kNumberMasks; mask++)
+        {
+            for (int module_x = 0; module_x < kMaskPeriod; module_x++)
+            {
+                for (int module_y = 0; module_y < kLineWords * kWordBits; module_y++)
+                {
+                    if (improc::qrcode::QrCodeEncoder::IsMaskedModule(mask,module_x,module_y) == true)
+                    {
+                        mask_columns[mask][module_x][module_y / kWordBits] |= uint64_t(1) << (module_y % kWordBits);
+                    }
+                }
+            }
+        }
+        return mask_columns;
+    }();
+    return kMaskColumns;
+}
+
+/**
+ * @brief Check if a module is inverted by a mask
+ * 
+ * @param mask - qr-code mask between 0 and 7
+ * @param module_x - module column
+ * @param module_y - module row
+ * @return bool - true if module is inverted, false otherwise.
+ */
+bool improc::qrcode::QrCodeEncoder::IsMaskedModule(int mask, int module_x, int module_y)
+{
+    switch (mask)
+    {
+        case 0: return (module_x + module_y) % 2 == 0;
+        case 1: return module_y % 2 == 0;
+        case 2: return module_x % 3 == 0;
+        case 3: return (module_x + module_y) % 3 == 0;
+        case 4: return (module_x / 3 + module_y / 2) % 2 == 0;
+        case 5: return module_x * module_y % 2 + module_x * module_y % 3 == 0;
+        case 6: return (module_x * module_y % 2 + module_x * module_y % 3) % 2 == 0;
+        case 7: return ((module_x + module_y) % 2 + module_x * module_y % 3) % 2 == 0;
+    }
+    return false;
+}
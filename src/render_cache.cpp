@@ -0,0 +1,190 @@
+#include <improc/drawer/engine/render_cache.hpp>
+
+#include <algorithm>
+#include <limits>
+
+/**
+ * @brief Construct a new improc::RenderCache object
+ *
+ * @param max_bytes - maximum number of bytes of cached element images
+ */
+improc::RenderCache::RenderCache(size_t max_bytes)  : max_bytes_(max_bytes)
+                                                    , bytes_(0)
+                                                    , entries_(std::list<Entry>())
+                                                    , entry_index_(std::unordered_map<std::uint64_t,std::list<Entry>::iterator>())
+                                                    , hits_(0)
+                                                    , misses_(0) {};
+
+/**
+ * @brief Construct a new improc::RenderCache object
+ *
+ * @param render_cache_json - configuration json for render cache
+ */
+improc::RenderCache::RenderCache(const Json::Value& render_cache_json) : improc::RenderCache(0)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Creating render cache...");
+    static const std::string kMaxBytesKey = "max-bytes";
+    if (render_cache_json.isMember(kMaxBytesKey) == false)
+    {
+        std::string error_message = fmt::format("Key {} is missing from render cache json",kMaxBytesKey);
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::json_error(std::move(error_message));
+    }
+    const Json::Value& max_bytes_json = render_cache_json[kMaxBytesKey];
+    if (max_bytes_json.isUInt64() == false || max_bytes_json.asUInt64() == 0)
+    {
+        std::string error_message = fmt::format("Render cache maximum bytes should be an integer greater than zero. {} bytes were gave",max_bytes_json.toStyledString());
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    this->max_bytes_ = static_cast<size_t>(std::min<std::uint64_t>(max_bytes_json.asUInt64(),std::numeric_limits<size_t>::max()));
+}
+
+/**
+ * @brief Find a cached element image, marking it as the most recently used
+ *
+ * @param key - content key of element image
+ * @param element_config - configuration of element drawer
+ * @param message - message of element image
+ * @return std::optional<cv::Mat> - cached element image, which must not be modified, or empty if not cached
+ */
+std::optional<cv::Mat> improc::RenderCache::Find(std::uint64_t key, const std::string& element_config, const std::optional<improc::DrawerVariant>& message)
+{
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    std::unordered_map<std::uint64_t,std::list<Entry>::iterator>::iterator index_iter = this->entry_index_.find(key);
+    if (index_iter == this->entry_index_.end() || improc::RenderCache::IsSameEntry(*index_iter->second,element_config,message) == false)
+    {
+        this->misses_++;
+        return std::nullopt;
+    }
+    this->hits_++;
+    this->entries_.splice(this->entries_.begin(),this->entries_,index_iter->second);
+    return index_iter->second->element_image;
+}
+
+/**
+ * @brief Find a cached element image without counting the lookup in the statistics nor marking it as used
+ *
+ * @param key - content key of element image
+ * @param element_config - configuration of element drawer
+ * @param message - message of element image
+ * @return std::optional<cv::Mat> - cached element image, which must not be modified, or empty if not cached
+ */
+std::optional<cv::Mat> improc::RenderCache::Peek(std::uint64_t key, const std::string& element_config, const std::optional<improc::DrawerVariant>& message) const
+{
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    std::unordered_map<std::uint64_t,std::list<Entry>::iterator>::const_iterator index_iter = this->entry_index_.find(key);
+    if (index_iter == this->entry_index_.end() || improc::RenderCache::IsSameEntry(*index_iter->second,element_config,message) == false)
+    {
+        return std::nullopt;
+    }
+    return index_iter->second->element_image;
+}
+
+/**
+ * @brief Cache an element image, evicting the least recently used element images beyond the byte budget.
+ * Element images larger than the byte budget are not cached. A cached element image with the same content key 
+ * but another element configuration or message is replaced. The element image is only copied when it is inserted.
+ *
+ * @param key - content key of element image
+ * @param element_config - configuration of element drawer, shared by the entries of the element drawer
+ * @param message - message of element image, copied to the cache
+ * @param element_image - element image, copied to the cache
+ */
+void improc::RenderCache::Insert( std::uint64_t key, const std::shared_ptr<const std::string>& element_config
+                                , const std::optional<improc::DrawerVariant>& message, const cv::Mat& element_image )
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Inserting element image in render cache...");
+    size_t bytes = element_image.total() * element_image.elemSize();
+    if (bytes > this->max_bytes_)
+    {
+        IMPROC_DRAWER_LOGGER_DEBUG("Element image with {} bytes exceeds render cache budget of {} bytes",bytes,this->max_bytes_);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    std::unordered_map<std::uint64_t,std::list<Entry>::iterator>::iterator index_iter = this->entry_index_.find(key);
+    if (index_iter != this->entry_index_.end())
+    {
+        if (improc::RenderCache::IsSameEntry(*index_iter->second,*element_config,message) == true)
+        {
+            return;
+        }
+        IMPROC_DRAWER_LOGGER_DEBUG("Replacing render cache entry with colliding key {}",key);
+        this->bytes_ -= index_iter->second->bytes;
+        this->entries_.erase(index_iter->second);
+        this->entry_index_.erase(index_iter);
+    }
+    while (this->bytes_ + bytes > this->max_bytes_)
+    {
+        this->bytes_ -= this->entries_.back().bytes;
+        this->entry_index_.erase(this->entries_.back().key);
+        this->entries_.pop_back();
+    }
+    this->entries_.push_front(Entry {key,element_config,message,element_image.clone(),bytes});
+    this->entry_index_.emplace(key,this->entries_.begin());
+    this->bytes_ += bytes;
+}
+
+/**
+ * @brief Remove all cached element images and reset statistics
+ */
+void improc::RenderCache::Clear()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Clearing render cache...");
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    this->entries_.clear();
+    this->entry_index_.clear();
+    this->bytes_  = 0;
+    this->hits_   = 0;
+    this->misses_ = 0;
+}
+
+/**
+ * @brief Obtain number of cached element images
+ */
+size_t improc::RenderCache::get_number_entries() const
+{
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    return this->entries_.size();
+}
+
+/**
+ * @brief Obtain number of bytes of cached element images
+ */
+size_t improc::RenderCache::get_bytes() const
+{
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    return this->bytes_;
+}
+
+/**
+ * @brief Obtain number of lookups that found a cached element image
+ */
+size_t improc::RenderCache::get_hits() const
+{
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    return this->hits_;
+}
+
+/**
+ * @brief Obtain number of lookups that did not find a cached element image
+ */
+size_t improc::RenderCache::get_misses() const
+{
+    std::lock_guard<std::mutex> lock {this->mutex_};
+    return this->misses_;
+}
+
+/**
+ * @brief Check if a cache entry was inserted for an element configuration and message
+ *
+ * @param entry - cache entry found by content key
+ * @param element_config - configuration of element drawer
+ * @param message - message of element image
+ * @return bool - true if entry has the same element configuration and message, false otherwise.
+ */
+bool improc::RenderCache::IsSameEntry(const Entry& entry, const std::string& element_config, const std::optional<improc::DrawerVariant>& message)
+{
+    return (entry.element_config.get() == &element_config || *entry.element_config == element_config) && entry.message == message;
+}
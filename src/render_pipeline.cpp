@@ -0,0 +1,268 @@
+#include <improc/drawer/render_pipeline.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Page context waiting to be drawn by a render pipeline worker
+     */
+    struct RenderJob
+    {
+        size_t                                  page_idx;
+        improc::RenderPipeline::PageContext     context;
+    };
+
+    /**
+     * @brief Page image drawn by a render pipeline worker, waiting to be delivered to the sink. 
+     * The ready flag is guarded by the mutex of the render state.
+     */
+    struct RenderSlot
+    {
+        bool                                    ready {false};
+        cv::Mat                                 page_image;
+    };
+
+    /**
+     * @brief Shared state of the stages of a render pipeline run. 
+     * Stages wait on a single condition variable, notified whenever a page is produced, drawn or delivered, so 
+     * waiting stages do not use the processor.
+     */
+    struct RenderState
+    {
+        size_t                                  produced_pages  {0};
+        size_t                                  delivered_pages {0};
+        bool                                    producer_done   {false};
+        std::atomic<bool>                       failed          {false};
+        std::mutex                              mutex;
+        std::condition_variable                 condition;
+        std::exception_ptr                      error;
+
+        /**
+         * @brief Store first error and stop all stages
+         */
+        void Fail(std::exception_ptr stage_error)
+        {
+            {
+                std::lock_guard<std::mutex> lock {this->mutex};
+                if (this->error == nullptr)
+                {
+                    this->error = std::move(stage_error);
+                }
+                this->failed.store(true,std::memory_order_release);
+            }
+            this->condition.notify_all();
+        }
+    };
+}
+
+/**
+ * @brief Construct a new improc::RenderPipeline object for a page drawer
+ *
+ * @param page_drawer - allocated page drawer used to draw the pages
+ * @param number_workers - number of threads drawing pages
+ * @param capacity - maximum number of pages in flight between producer and sink
+ */
+improc::RenderPipeline::RenderPipeline(const improc::PageDrawer& page_drawer, unsigned int number_workers, size_t capacity)
+    : improc::RenderPipeline ( [&page_drawer] (cv::Mat& page_image, const PageContext& context) {page_drawer.Draw(page_image,context);}
+                             , number_workers, capacity ) {};
+
+/**
+ * @brief Construct a new improc::RenderPipeline object for a layout drawer
+ *
+ * @param layout_drawer - allocated layout drawer used to draw the pages
+ * @param number_workers - number of threads drawing pages
+ * @param capacity - maximum number of pages in flight between producer and sink
+ */
+improc::RenderPipeline::RenderPipeline(const improc::LayoutDrawer& layout_drawer, unsigned int number_workers, size_t capacity)
+    : improc::RenderPipeline ( [&layout_drawer] (cv::Mat& page_image, const PageContext& context) {layout_drawer.Draw(page_image,context);}
+                             , number_workers, capacity ) {};
+
+/**
+ * @brief Construct a new improc::RenderPipeline object for a render plan
+ *
+ * @param render_plan - render plan used to draw the pages
+ * @param number_workers - number of threads drawing pages
+ * @param capacity - maximum number of pages in flight between producer and sink
+ */
+improc::RenderPipeline::RenderPipeline(const std::shared_ptr<const improc::RenderPlan>& render_plan, unsigned int number_workers, size_t capacity)
+    : improc::RenderPipeline ( [render_plan] (cv::Mat& page_image, const PageContext& context) {render_plan->Draw(page_image,context);}
+                             , number_workers, capacity )
+{
+    if (render_plan == nullptr)
+    {
+        std::string error_message = "Render plan not defined when creating render pipeline";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::processing_flow_error(std::move(error_message));
+    }
+}
+
+/**
+ * @brief Construct a new improc::RenderPipeline object
+ *
+ * @param draw_page - function drawing a page context in a page image
+ * @param number_workers - number of threads drawing pages
+ * @param capacity - maximum number of pages in flight between producer and sink
+ */
+improc::RenderPipeline::RenderPipeline(std::function<void(cv::Mat&,const PageContext&)>&& draw_page, unsigned int number_workers, size_t capacity)
+    : draw_page_(std::move(draw_page))
+    , number_workers_(number_workers)
+    , capacity_(capacity)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Creating render pipeline...");
+    if (number_workers == 0)
+    {
+        std::string error_message = "Number of render pipeline workers should be greater than zero";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (capacity == 0)
+    {
+        std::string error_message = "Render pipeline capacity should be greater than zero";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+}
+
+/**
+ * @brief Draw the pages of the contexts given by the producer and deliver them to the sink
+ *
+ * The producer runs in its own thread and is called until it returns an empty context. Pages are drawn by
+ * the workers and delivered to the sink in the calling thread, in the same order as the contexts. The page
+ * image given to the sink is reused for later pages, so it is only valid during the sink call. The first
+ * exception thrown by the producer, the workers or the sink stops the pipeline and is rethrown.
+ *
+ * @param producer - function giving the next page context, or an empty context when there are no more pages
+ * @param sink - function receiving the page index and the page image
+ * @return size_t - number of pages delivered to the sink
+ */
+size_t improc::RenderPipeline::Run(const Producer& producer, const Sink& sink) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Running render pipeline...");
+    improc::BoundedQueue<RenderJob> jobs  {this->capacity_};
+    std::unique_ptr<RenderSlot[]>   slots = std::make_unique<RenderSlot[]>(this->capacity_);
+    RenderState                     state {};
+
+    std::thread producer_thread {[this,&producer,&jobs,&state] ()
+        {
+            try
+            {
+                for (size_t page_idx = 0; state.failed.load(std::memory_order_acquire) == false; page_idx++)
+                {
+                    std::optional<PageContext> context = producer();
+                    if (context.has_value() == false)
+                    {
+                        break;
+                    }
+
+                    // Back-pressure: only start a page once the sink released the slot used capacity pages before.
+                    {
+                        std::unique_lock<std::mutex> lock {state.mutex};
+                        state.condition.wait(lock,[this,&state,page_idx] () 
+                            {
+                                return page_idx < state.delivered_pages + this->capacity_ || state.failed.load(std::memory_order_acquire) == true;
+                            }
+                        );
+                    }
+                    if (jobs.Push(RenderJob {page_idx,std::move(context.value())}) == false)
+                    {
+                        break;
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock {state.mutex};
+                        state.produced_pages = page_idx + 1;
+                    }
+                }
+            }
+            catch (...)
+            {
+                state.Fail(std::current_exception());
+            }
+            {
+                std::lock_guard<std::mutex> lock {state.mutex};
+                state.producer_done = true;
+            }
+            state.condition.notify_all();
+            jobs.Close();
+        }
+    };
+
+    std::vector<std::thread> worker_threads {};
+    worker_threads.reserve(this->number_workers_);
+    for (unsigned int worker_idx = 0; worker_idx < this->number_workers_; worker_idx++)
+    {
+        worker_threads.emplace_back([this,&jobs,&slots,&state] ()
+            {
+                try
+                {
+                    for (std::optional<RenderJob> job = jobs.Pop(); job.has_value() == true; job = jobs.Pop())
+                    {
+                        if (state.failed.load(std::memory_order_acquire) == true)
+                        {
+                            return;
+                        }
+                        RenderSlot& slot = slots[job->page_idx % this->capacity_];
+                        this->draw_page_(slot.page_image,job->context);
+                        {
+                            std::lock_guard<std::mutex> lock {state.mutex};
+                            slot.ready = true;
+                        }
+                        state.condition.notify_all();
+                    }
+                }
+                catch (...)
+                {
+                    state.Fail(std::current_exception());
+                    jobs.Close();
+                }
+            }
+        );
+    }
+
+    try
+    {
+        for (size_t page_idx = 0; ; page_idx++)
+        {
+            RenderSlot& slot = slots[page_idx % this->capacity_];
+            {
+                std::unique_lock<std::mutex> lock {state.mutex};
+                state.condition.wait(lock,[&state,&slot,page_idx] () 
+                    {
+                        return slot.ready == true || state.failed.load(std::memory_order_acquire) == true 
+                            || (state.producer_done == true && page_idx >= state.produced_pages);
+                    }
+                );
+                if (slot.ready == false || state.failed.load(std::memory_order_acquire) == true)
+                {
+                    break;
+                }
+            }
+            sink(page_idx,slot.page_image);
+            {
+                std::lock_guard<std::mutex> lock {state.mutex};
+                slot.ready = false;
+                state.delivered_pages = page_idx + 1;
+            }
+            state.condition.notify_all();
+        }
+    }
+    catch (...)
+    {
+        state.Fail(std::current_exception());
+        jobs.Close();
+    }
+
+    producer_thread.join();
+    std::for_each(worker_threads.begin(),worker_threads.end(),[] (std::thread& worker) {worker.join();});
+    if (state.error != nullptr)
+    {
+        std::rethrow_exception(state.error);
+    }
+    IMPROC_DRAWER_LOGGER_DEBUG("Render pipeline delivered {} pages",state.delivered_pages);
+    return state.delivered_pages;
+}
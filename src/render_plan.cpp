@@ -0,0 +1,482 @@
+#include <improc/drawer/engine/render_plan.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+    /**
+     * @brief Copy a borrowed payload to an owned payload, reusing the owned payload storage whenever it has the same type
+     */
+    template <typename PayloadType, typename PayloadViewType>
+    void AssignPayload(std::optional<improc::DrawerVariant>& message, const PayloadViewType& payload_view)
+    {
+        if (message.has_value() == false || std::holds_alternative<PayloadType>(message.value()) == false)
+        {
+            message.emplace(std::in_place_type<PayloadType>);
+        }
+        std::get<PayloadType>(message.value()).assign(payload_view.begin(),payload_view.end());
+    }
+}
+
+/**
+ * @brief Construct a new improc::RenderPlan object from allocated page elements
+ *
+ * @param page_size - page size in pixels
+ * @param background - page image with static page elements drawed, copied to the render plan
+ * @param page_elements - allocated page elements
+ */
+improc::RenderPlan::RenderPlan(const cv::Size& page_size, const cv::Mat& background, const std::vector<improc::PageElementDrawer>& page_elements)
+    : page_size_(page_size)
+    , background_(background.clone())
+    , drawers_(std::vector<improc::ElementDrawer>())
+    , element_boxes_(std::vector<cv::Rect>())
+    , element_scales_(std::vector<unsigned int>())
+    , drawer_indexes_(std::vector<size_t>())
+    , static_elements_(std::vector<bool>())
+    , static_contents_(std::vector<std::optional<improc::DrawerVariant>>())
+    , draw_levels_(std::vector<std::vector<size_t>>())
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Compiling render plan...");
+    if (this->background_.size() != this->page_size_)
+    {
+        std::string error_message = fmt::format ( "Render plan background (w={},h={}) should have the page size (w={},h={})"
+                                                , this->background_.size().width, this->background_.size().height
+                                                , this->page_size_.width, this->page_size_.height );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    this->element_boxes_.reserve(page_elements.size());
+    this->element_scales_.reserve(page_elements.size());
+    this->drawer_indexes_.reserve(page_elements.size());
+    this->static_elements_.reserve(page_elements.size());
+    this->static_contents_.reserve(page_elements.size());
+    size_t last_drawer_idx = 0;
+    for (const improc::PageElementDrawer& elem : page_elements)
+    {
+        if (elem.get_element_box().empty() == true)
+        {
+            std::string error_message = "Please allocate page elements before compiling render plan";
+            IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+            throw improc::processing_flow_error(std::move(error_message));
+        }
+
+        // Consecutive page elements usually share their element drawer, as in grid cells, so the last match is checked first.
+        const improc::ElementDrawer& element_drawer = elem.get_element_drawer();
+        if (this->drawers_.empty() == true || this->drawers_[last_drawer_idx].IsSameElement(element_drawer) == false)
+        {
+            std::vector<improc::ElementDrawer>::const_iterator drawer_iter = std::find_if   ( this->drawers_.begin(),this->drawers_.end()
+                                                                                            , [&element_drawer] (const improc::ElementDrawer& drawer) {return drawer.IsSameElement(element_drawer);} );
+            if (drawer_iter == this->drawers_.end())
+            {
+                this->drawers_.push_back(element_drawer);
+                drawer_iter = std::prev(this->drawers_.end());
+            }
+            last_drawer_idx = std::distance(this->drawers_.cbegin(),drawer_iter);
+        }
+
+        this->element_boxes_.push_back(elem.get_element_box());
+        this->element_scales_.push_back(elem.get_element_scale());
+        this->drawer_indexes_.push_back(last_drawer_idx);
+        this->static_elements_.push_back(elem.is_element_static());
+        if (elem.is_element_static() == true)
+        {
+            this->static_contents_.push_back(elem.get_content());
+        }
+        else
+        {
+            this->static_contents_.emplace_back();
+        }
+    }
+    this->ComputeDrawLevels();
+    IMPROC_DRAWER_LOGGER_DEBUG("Render plan with {} page elements and {} element drawers",this->element_boxes_.size(),this->drawers_.size());
+}
+
+/**
+ * @brief Group dynamic page elements in draw levels.
+ * Each page element is placed in the level after the last level containing an earlier page element that
+ * overlaps with it, so page elements in the same level have disjoint element boxes.
+ */
+improc::RenderPlan& improc::RenderPlan::ComputeDrawLevels()
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Computing draw levels...");
+    std::vector<size_t>     dynamic_indexes {};
+    std::vector<size_t>     dynamic_levels  {};
+    this->draw_levels_.clear();
+
+    for (size_t elem_idx = 0; elem_idx < this->element_boxes_.size(); elem_idx++)
+    {
+        if (this->static_elements_[elem_idx] == false)
+        {
+            const cv::Rect& element_box = this->element_boxes_[elem_idx];
+            size_t          draw_level  = 0;
+            for (size_t dynamic_idx = 0; dynamic_idx < dynamic_indexes.size(); dynamic_idx++)
+            {
+                if ((this->element_boxes_[dynamic_indexes[dynamic_idx]] & element_box).empty() == false)
+                {
+                    draw_level = std::max(draw_level,dynamic_levels[dynamic_idx] + 1);
+                }
+            }
+            if (draw_level == this->draw_levels_.size())
+            {
+                this->draw_levels_.push_back(std::vector<size_t>());
+            }
+            this->draw_levels_[draw_level].push_back(elem_idx);
+            dynamic_indexes.push_back(elem_idx);
+            dynamic_levels.push_back(draw_level);
+        }
+    }
+    IMPROC_DRAWER_LOGGER_DEBUG("Dynamic page elements grouped in {} draw levels",this->draw_levels_.size());
+    return (*this);
+}
+
+/**
+ * @brief Validate if context has one message per page element
+ *
+ * @param context_size - number of messages in context
+ */
+void improc::RenderPlan::ValidateContext(size_t context_size) const
+{
+    if (this->element_boxes_.size() != context_size)
+    {
+        std::string error_message = fmt::format ( "Number of elements in context ({}) different than the number of elements in page ({})"
+                                                , context_size, this->element_boxes_.size() );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+}
+
+/**
+ * @brief Draw page in a given page image.
+ * The page image is initialized from the page background, reusing its data whenever it already has the page size.
+ *
+ * @param page_image - page image to draw page
+ * @param context - list of messages to be considered in page
+ */
+void improc::RenderPlan::Draw(cv::Mat& page_image, const std::list<std::optional<improc::DrawerVariant>>& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing render plan in page image...");
+    this->ValidateContext(context.size());
+    this->background_.copyTo(page_image);
+    this->DrawElements(page_image,std::move(context));
+}
+
+/**
+ * @brief Draw dynamic page elements in a page image
+ *
+ * @param page_image - page image to draw page elements
+ * @param context - list of messages to be considered in page
+ */
+void improc::RenderPlan::DrawElements(cv::Mat& page_image, const std::list<std::optional<improc::DrawerVariant>>& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing render plan elements...");
+    this->ValidateContext(context.size());
+    this->DrawMessages(page_image,improc::RenderPlan::GetListAccessor(context));
+}
+
+/**
+ * @brief Draw dynamic page elements in a page image using a worker pool.
+ * Page elements in the same draw level are drawn concurrently and draw levels are drawn in sequence.
+ *
+ * @param page_image - page image to draw page elements
+ * @param context - list of messages to be considered in page
+ * @param worker_pool - worker pool used to draw the page elements
+ */
+void improc::RenderPlan::DrawElements(cv::Mat& page_image, const std::list<std::optional<improc::DrawerVariant>>& context, improc::WorkerPool& worker_pool) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing render plan elements using worker pool...");
+    this->ValidateContext(context.size());
+    std::vector<const std::optional<DrawerVariant>*> messages {};
+    messages.reserve(context.size());
+    std::for_each(context.begin(),context.end(),[&messages] (const std::optional<improc::DrawerVariant>& message) {messages.push_back(&message);});
+
+    for (const std::vector<size_t>& draw_level : this->draw_levels_)
+    {
+        worker_pool.Run ( draw_level.size()
+                        , [this,&page_image,&draw_level,&messages] (size_t level_idx)
+                            {
+                                size_t  elem_idx      = draw_level[level_idx];
+                                cv::Mat element_image = page_image(this->element_boxes_[elem_idx]);
+                                this->drawers_[this->drawer_indexes_[elem_idx]].DrawInto(element_image,*messages[elem_idx]);
+                            }
+                        );
+    }
+}
+
+/**
+ * @brief Verify page image
+ *
+ * @param page_image - page image to be verified
+ * @param context - list of messages to be considered in page
+ * @return bool - true if page is correct, false otherwise.
+ */
+bool improc::RenderPlan::Verify(const cv::Mat& page_image, const std::list<std::optional<improc::DrawerVariant>>& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying render plan...");
+    this->ValidateContext(context.size());
+    return this->VerifyMessages(page_image,improc::RenderPlan::GetListAccessor(context));
+}
+
+/**
+ * @brief Verify page image using a worker pool.
+ * Page elements are verified concurrently, taken in page order. With the fail fast policy, page elements not yet
+ * started when a page element fails are skipped. Page elements already being verified are not interrupted.
+ *
+ * @param page_image - page image to be verified
+ * @param context - list of messages to be considered in page
+ * @param worker_pool - worker pool used to verify the page elements
+ * @param policy - verification policy
+ * @return improc::VerificationReport - verification result and time of every page element
+ */
+improc::VerificationReport improc::RenderPlan::Verify(const cv::Mat& page_image, const std::list<std::optional<improc::DrawerVariant>>& context, improc::WorkerPool& worker_pool, improc::VerificationPolicy policy) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying render plan using worker pool...");
+    this->ValidateContext(context.size());
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    std::vector<const std::optional<DrawerVariant>*> messages {};
+    messages.reserve(context.size());
+    std::for_each(context.begin(),context.end(),[&messages] (const std::optional<improc::DrawerVariant>& message) {messages.push_back(&message);});
+
+    std::vector<improc::VerificationReport::ElementResult> element_results (this->element_boxes_.size(),improc::VerificationReport::ElementResult {false,false,std::chrono::nanoseconds::zero()});
+    std::atomic<bool> has_failed {false};
+    worker_pool.Run ( this->element_boxes_.size()
+                    , [this,&page_image,&messages,&element_results,&has_failed,&policy] (size_t elem_idx)
+                        {
+                            if (policy == improc::VerificationPolicy::kFailFast && has_failed.load(std::memory_order_relaxed) == true)
+                            {
+                                return;
+                            }
+                            std::chrono::steady_clock::time_point elem_start_time = std::chrono::steady_clock::now();
+                            bool is_valid = this->VerifyElement(page_image,elem_idx,*messages[elem_idx]);
+                            element_results[elem_idx] = improc::VerificationReport::ElementResult {true,is_valid,std::chrono::steady_clock::now() - elem_start_time};
+                            if (is_valid == false)
+                            {
+                                has_failed.store(true,std::memory_order_relaxed);
+                            }
+                        }
+                    );
+    improc::VerificationReport report {std::move(element_results),std::chrono::steady_clock::now() - start_time};
+    IMPROC_DRAWER_LOGGER_DEBUG  ( "Verified {} of {} page elements using {} policy"
+                                , report.GetNumberVerified(), this->element_boxes_.size(), policy.ToString() );
+    return report;
+}
+
+/**
+ * @brief Verify a single page element of a page image. 
+ * Static page elements are verified with their content, ignoring the given message, and with the scale factor 
+ * obtained when allocating. The scale factor of dynamic page elements is validated against the message.
+ *
+ * @param page_image - page image to be verified
+ * @param elem_idx - index of page element
+ * @param message - message to be considered in page element
+ * @return bool - true if page element is correct, false otherwise.
+ */
+bool improc::RenderPlan::VerifyElement(const cv::Mat& page_image, size_t elem_idx, const std::optional<improc::DrawerVariant>& message) const
+{
+    if (elem_idx >= this->element_boxes_.size())
+    {
+        std::string error_message = fmt::format("Element index {} should be lower than the number of elements in page ({})",elem_idx,this->element_boxes_.size());
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    const improc::ElementDrawer& element_drawer = this->drawers_[this->drawer_indexes_[elem_idx]];
+    const cv::Rect&              element_box    = this->element_boxes_[elem_idx];
+    if (this->static_elements_[elem_idx] == true)
+    {
+        return element_drawer.Verify(page_image(element_box),this->element_scales_[elem_idx],this->static_contents_[elem_idx]);
+    }
+    unsigned int element_scale = element_drawer.GetScaleFactor(element_box.size(),this->element_scales_[elem_idx],message);
+    return element_drawer.Verify(page_image(element_box),element_scale,message);
+}
+
+/**
+ * @brief Obtain message with the payload of a borrowed message. 
+ * The message is stored per thread and reused, so it is only valid until the next call in the same thread.
+ *
+ * @param message_view - borrowed message
+ * @return const std::optional<DrawerVariant>& - message with a copy of the borrowed payload
+ */
+const std::optional<improc::DrawerVariant>& improc::RenderPlan::BorrowMessage(const std::optional<improc::DrawerVariantView>& message_view)
+{
+    static const std::optional<improc::DrawerVariant>   kEmptyMessage {};
+    thread_local std::optional<improc::DrawerVariant>   message       {};
+    if (message_view.has_value() == false)
+    {
+        return kEmptyMessage;
+    }
+
+    const improc::DrawerVariantView& payload_view = message_view.value();
+    if (std::holds_alternative<std::string_view>(payload_view) == true)
+    {
+        AssignPayload<std::string>(message,std::get<std::string_view>(payload_view));
+    }
+    else if (std::holds_alternative<improc::ConstSpan<std::byte>>(payload_view) == true)
+    {
+        AssignPayload<std::vector<std::byte>>(message,std::get<improc::ConstSpan<std::byte>>(payload_view));
+    }
+    else
+    {
+        AssignPayload<std::vector<unsigned int>>(message,std::get<improc::ConstSpan<unsigned int>>(payload_view));
+    }
+    return message;
+}
+
+/**
+ * @brief Draw page in a given page image using a context with borrowed messages.
+ * The page image is initialized from the page background, reusing its data whenever it already has the page size.
+ *
+ * @param page_image - page image to draw page
+ * @param context - view of messages to be considered in page
+ */
+void improc::RenderPlan::Draw(cv::Mat& page_image, const improc::DrawerContextView& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing render plan in page image from context view...");
+    this->ValidateContext(context.size());
+    this->background_.copyTo(page_image);
+    this->DrawElements(page_image,context);
+}
+
+/**
+ * @brief Draw dynamic page elements in a page image using a context with borrowed messages
+ *
+ * @param page_image - page image to draw page elements
+ * @param context - view of messages to be considered in page
+ */
+void improc::RenderPlan::DrawElements(cv::Mat& page_image, const improc::DrawerContextView& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing render plan elements from context view...");
+    this->ValidateContext(context.size());
+    this->DrawMessages(page_image,[&context] (size_t elem_idx) -> const std::optional<improc::DrawerVariant>& {return improc::RenderPlan::BorrowMessage(context[elem_idx]);});
+}
+
+/**
+ * @brief Verify page image using a context with borrowed messages
+ *
+ * @param page_image - page image to be verified
+ * @param context - view of messages to be considered in page
+ * @return bool - true if page is correct, false otherwise.
+ */
+bool improc::RenderPlan::Verify(const cv::Mat& page_image, const improc::DrawerContextView& context) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying render plan from context view...");
+    this->ValidateContext(context.size());
+    return this->VerifyMessages(page_image,[&context] (size_t elem_idx) -> const std::optional<improc::DrawerVariant>& {return improc::RenderPlan::BorrowMessage(context[elem_idx]);});
+}
+
+/**
+ * @brief Draw dynamic page elements in a page image, obtaining the message of each page element in page order
+ *
+ * @param page_image - page image to draw page elements
+ * @param get_message - accessor of the message of a page element
+ */
+void improc::RenderPlan::DrawMessages(cv::Mat& page_image, const MessageAccessor& get_message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing render plan messages...");
+    for (size_t elem_idx = 0; elem_idx < this->element_boxes_.size(); elem_idx++)
+    {
+        if (this->static_elements_[elem_idx] == false)
+        {
+            cv::Mat element_image = page_image(this->element_boxes_[elem_idx]);
+            this->drawers_[this->drawer_indexes_[elem_idx]].DrawInto(element_image,get_message(elem_idx));
+        }
+    }
+}
+
+/**
+ * @brief Verify page image, obtaining the message of each dynamic page element in page order. 
+ * Static page elements are verified with their content, so their messages are not obtained.
+ *
+ * @param page_image - page image to be verified
+ * @param get_message - accessor of the message of a page element
+ * @return bool - true if page is correct, false otherwise.
+ */
+bool improc::RenderPlan::VerifyMessages(const cv::Mat& page_image, const MessageAccessor& get_message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Verifying render plan messages...");
+    bool is_valid = true;
+    for (size_t elem_idx = 0; elem_idx < this->element_boxes_.size(); elem_idx++)
+    {
+        const std::optional<improc::DrawerVariant>& message = this->static_elements_[elem_idx] == true ? this->static_contents_[elem_idx] 
+                                                                                                       : get_message(elem_idx);
+        if (this->VerifyElement(page_image,elem_idx,message) == false)
+        {
+            is_valid = false;
+        }
+    }
+    return is_valid;
+}
+
+/**
+ * @brief Obtain accessor of the messages of a list context. 
+ * The list is walked forward, so messages must be obtained in page order.
+ *
+ * @param context - list of messages to be considered in page
+ * @return MessageAccessor - accessor of the message of a page element
+ */
+improc::RenderPlan::MessageAccessor improc::RenderPlan::GetListAccessor(const std::list<std::optional<improc::DrawerVariant>>& context)
+{
+    return  [message_iter = context.begin(), message_idx = size_t(0)] (size_t elem_idx) mutable -> const std::optional<improc::DrawerVariant>&
+            {
+                std::advance(message_iter,elem_idx - message_idx);
+                message_idx = elem_idx;
+                return *message_iter;
+            };
+}
+
+/**
+ * @brief Draw again some dynamic page elements of a drawn page image.
+ * Page elements drawn after a redrawn page element and overlapping it are also drawn again, in page order, 
+ * so the page image is the same as drawing the whole page with the given messages.
+ *
+ * @param page_image - drawn page image to update
+ * @param messages - messages of every page element, including the page elements that did not change
+ * @param slots - indexes of the page elements that changed
+ */
+void improc::RenderPlan::DrawSlots(cv::Mat& page_image, const std::vector<std::optional<improc::DrawerVariant>>& messages, const std::vector<size_t>& slots) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing render plan slots...");
+    this->ValidateContext(messages.size());
+    if (page_image.size() != this->page_size_)
+    {
+        std::string error_message = fmt::format ( "Page image (w={},h={}) should have the page size (w={},h={})"
+                                                , page_image.size().width, page_image.size().height
+                                                , this->page_size_.width, this->page_size_.height );
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+    if (slots.empty() == true)
+    {
+        return;
+    }
+
+    std::vector<bool> changed_slots (this->element_boxes_.size(),false);
+    for (size_t slot : slots)
+    {
+        if (slot >= this->element_boxes_.size())
+        {
+            std::string error_message = fmt::format("Slot {} should be lower than the number of elements in page ({})",slot,this->element_boxes_.size());
+            IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+            throw improc::value_error(std::move(error_message));
+        }
+        changed_slots[slot] = true;
+    }
+
+    std::vector<cv::Rect> redrawn_boxes {};
+    for (size_t elem_idx = *std::min_element(slots.begin(),slots.end()); elem_idx < this->element_boxes_.size(); elem_idx++)
+    {
+        if (this->static_elements_[elem_idx] == true)
+        {
+            continue;
+        }
+        const cv::Rect& element_box = this->element_boxes_[elem_idx];
+        if (   changed_slots[elem_idx] == true 
+            || std::any_of(redrawn_boxes.begin(),redrawn_boxes.end(),[&element_box] (const cv::Rect& redrawn_box) {return (redrawn_box & element_box).empty() == false;}) )
+        {
+            cv::Mat element_image = page_image(element_box);
+            this->drawers_[this->drawer_indexes_[elem_idx]].DrawInto(element_image,messages[elem_idx]);
+            redrawn_boxes.push_back(element_box);
+        }
+    }
+    IMPROC_DRAWER_LOGGER_DEBUG("Redrawn {} page elements for {} changed slots",redrawn_boxes.size(),slots.size());
+}
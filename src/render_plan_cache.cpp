@@ -0,0 +1,352 @@
+#include <improc/drawer/engine/render_plan_cache.hpp>
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+#if defined(_WIN32)
+#   include <iterator>
+#   include <process.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr std::array<char,8>    kCacheMagic         {'I','M','P','R','P','L','A','N'};
+    constexpr std::uint32_t         kByteOrderMark      = 0x01020304;
+
+    /**
+     * @brief Obtain a temporary filepath next to a file, unique to the calling process and call
+     *
+     * @param filepath - filepath of the file to be replaced
+     * @return std::string - temporary filepath
+     */
+    std::string GetTemporaryFilepath(const std::string& filepath)
+    {
+#if defined(_WIN32)
+        int process_id = _getpid();
+#else
+        pid_t process_id = getpid();
+#endif
+        thread_local std::mt19937_64 random_generator {std::random_device{}()};
+        std::ostringstream temporary_filepath {};
+        temporary_filepath << filepath << "." << process_id << "." << std::hex << random_generator() << ".tmp";
+        return temporary_filepath.str();
+    }
+
+    /**
+     * @brief Read-only view of a file, memory mapped whenever the platform supports it
+     */
+    class MappedFile final
+    {
+        private:
+            const unsigned char*        data_;
+            size_t                      size_;
+#if defined(_WIN32)
+            std::vector<unsigned char>  buffer_;
+#endif
+
+        public:
+            explicit MappedFile(const std::string& filepath) : data_(nullptr), size_(0)
+            {
+#if defined(_WIN32)
+                std::ifstream file {filepath,std::ios::binary};
+                if (file.is_open() == true)
+                {
+                    this->buffer_ = std::vector<unsigned char>(std::istreambuf_iterator<char>(file),std::istreambuf_iterator<char>());
+                    this->data_   = this->buffer_.data();
+                    this->size_   = this->buffer_.size();
+                }
+#else
+                int file_descriptor = open(filepath.c_str(),O_RDONLY);
+                if (file_descriptor < 0)
+                {
+                    return;
+                }
+                struct stat file_status {};
+                if (fstat(file_descriptor,&file_status) == 0 && file_status.st_size > 0)
+                {
+                    void* mapping = mmap(nullptr,file_status.st_size,PROT_READ,MAP_PRIVATE,file_descriptor,0);
+                    if (mapping != MAP_FAILED)
+                    {
+                        this->data_ = static_cast<const unsigned char*>(mapping);
+                        this->size_ = file_status.st_size;
+                    }
+                }
+                close(file_descriptor);
+#endif
+            }
+
+            ~MappedFile()
+            {
+#if !defined(_WIN32)
+                if (this->data_ != nullptr)
+                {
+                    munmap(const_cast<unsigned char*>(this->data_),this->size_);
+                }
+#endif
+            }
+
+            MappedFile(const MappedFile&  that) = delete;
+            MappedFile& operator=(const MappedFile&  that) = delete;
+
+            inline const unsigned char* get_data() const {return this->data_;}
+            inline size_t               get_size() const {return this->size_;}
+    };
+
+    /**
+     * @brief Sequential reader of fixed size fields from a byte buffer
+     */
+    class ByteReader final
+    {
+        private:
+            const unsigned char*        data_;
+            size_t                      size_;
+            size_t                      position_;
+
+        public:
+            explicit ByteReader(const unsigned char* data, size_t size) : data_(data), size_(size), position_(0) {}
+
+            template <typename FieldType>
+            bool                        Read(FieldType& field)
+            {
+                return this->Read(&field,sizeof(FieldType));
+            }
+
+            bool                        Read(void* destination, size_t number_bytes)
+            {
+                if (number_bytes > this->size_ - this->position_)
+                {
+                    return false;
+                }
+                std::memcpy(destination,this->data_ + this->position_,number_bytes);
+                this->position_ += number_bytes;
+                return true;
+            }
+
+            inline bool                 IsAtEnd() const {return this->position_ == this->size_;}
+    };
+
+    /**
+     * @brief Sequential writer of fixed size fields to an output file
+     */
+    template <typename FieldType>
+    void WriteField(std::ofstream& file, const FieldType& field)
+    {
+        file.write(reinterpret_cast<const char*>(&field),sizeof(FieldType));
+    }
+
+    /**
+     * @brief Add the path and content of every file referenced by a json string value to a FNV-1a hash
+     */
+    std::uint64_t HashReferencedFiles(std::uint64_t hash, const Json::Value& json_value, const std::filesystem::path& application_folder)
+    {
+        if (json_value.isString() == true)
+        {
+            std::error_code error_code {};
+            std::filesystem::path filepath {json_value.asString()};
+            if (filepath.is_relative() == true)
+            {
+                filepath = application_folder / filepath;
+            }
+            if (json_value.asString().empty() == false && std::filesystem::is_regular_file(filepath,error_code) == true)
+            {
+                std::string filepath_str = filepath.string();
+                hash = improc::BaseDrawer::HashBytes(hash,filepath_str.data(),filepath_str.size());
+                MappedFile file {filepath_str};
+                hash = improc::BaseDrawer::HashBytes(hash,file.get_data(),file.get_size());
+            }
+        }
+        else if (json_value.isArray() == true || json_value.isObject() == true)
+        {
+            for (const Json::Value& json_elem : json_value)
+            {
+                hash = HashReferencedFiles(hash,json_elem,application_folder);
+            }
+        }
+        return hash;
+    }
+}
+
+/**
+ * @brief Construct a new improc::RenderPlanCache object with the key of a page configuration
+ *
+ * @param cache_filepath - cache file path
+ * @param page_drawer_json - configuration json of page, grid or layout drawer
+ */
+improc::RenderPlanCache::RenderPlanCache(const std::string& cache_filepath, const Json::Value& page_drawer_json)
+    : improc::RenderPlanCache(cache_filepath,improc::RenderPlanCache::ComputeKey(page_drawer_json)) {};
+
+/**
+ * @brief Construct a new improc::RenderPlanCache object
+ *
+ * @param cache_filepath - cache file path
+ * @param key - key identifying the cached page allocation
+ */
+improc::RenderPlanCache::RenderPlanCache(const std::string& cache_filepath, std::uint64_t key) : cache_filepath_(cache_filepath)
+                                                                                               , key_(key) {};
+
+/**
+ * @brief Compute cache key of a page configuration.
+ * The key covers the cache format version, the configuration json and the path and content of every file
+ * referenced by a string value of the configuration, resolved against the application folder when relative.
+ *
+ * @param page_drawer_json - configuration json of page, grid or layout drawer
+ * @return std::uint64_t - cache key
+ */
+std::uint64_t improc::RenderPlanCache::ComputeKey(const Json::Value& page_drawer_json)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Computing render plan cache key...");
+    Json::StreamWriterBuilder writer_builder {};
+    writer_builder["indentation"] = "";
+    std::string json_str = Json::writeString(writer_builder,page_drawer_json);
+
+    std::uint64_t hash = improc::BaseDrawer::kHashOffsetBasis;
+    hash = improc::BaseDrawer::HashBytes(hash,&improc::RenderPlanCache::kFormatVersion,sizeof(improc::RenderPlanCache::kFormatVersion));
+    hash = improc::BaseDrawer::HashBytes(hash,json_str.data(),json_str.size());
+    hash = HashReferencedFiles(hash,page_drawer_json,std::filesystem::path(improc::ApplicationContext::get()->get_application_folder()));
+    return hash;
+}
+
+/**
+ * @brief Read cached page allocation.
+ * The cached page allocation is discarded if the cache file does not exist, is truncated or was written
+ * with a different format version, byte order or key.
+ *
+ * @return std::optional<CachedAllocation> - cached page allocation, empty if cache is missing or invalid
+ */
+std::optional<improc::RenderPlanCache::CachedAllocation> improc::RenderPlanCache::Read() const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Reading render plan cache...");
+    MappedFile cache_file {this->cache_filepath_};
+    if (cache_file.get_data() == nullptr)
+    {
+        IMPROC_DRAWER_LOGGER_DEBUG("Render plan cache {} not found",this->cache_filepath_);
+        return std::nullopt;
+    }
+
+    ByteReader          reader          {cache_file.get_data(),cache_file.get_size()};
+    std::array<char,8>  magic           {};
+    std::uint32_t       format_version  {};
+    std::uint32_t       byte_order_mark {};
+    std::uint64_t       key             {};
+    if (  reader.Read(magic.data(),magic.size()) == false || magic != kCacheMagic
+       || reader.Read(format_version)  == false || format_version  != improc::RenderPlanCache::kFormatVersion
+       || reader.Read(byte_order_mark) == false || byte_order_mark != kByteOrderMark
+       || reader.Read(key)             == false || key             != this->key_ )
+    {
+        IMPROC_DRAWER_LOGGER_DEBUG("Render plan cache {} is stale",this->cache_filepath_);
+        return std::nullopt;
+    }
+
+    std::int32_t  page_width      {};
+    std::int32_t  page_height     {};
+    std::int32_t  data_type       {};
+    std::uint64_t number_elements {};
+    if (  reader.Read(page_width) == false || reader.Read(page_height) == false || reader.Read(data_type) == false
+       || reader.Read(number_elements) == false || page_width <= 0 || page_height <= 0
+       || data_type != improc::BaseDrawer::kImageDataType || number_elements > cache_file.get_size() )
+    {
+        IMPROC_DRAWER_LOGGER_DEBUG("Render plan cache {} is corrupted",this->cache_filepath_);
+        return std::nullopt;
+    }
+
+    CachedAllocation cached_allocation {};
+    cached_allocation.page_size = cv::Size(page_width,page_height);
+    cached_allocation.element_boxes.reserve(number_elements);
+    cached_allocation.element_scales.reserve(number_elements);
+    cached_allocation.static_elements.reserve(number_elements);
+    for (std::uint64_t elem_idx = 0; elem_idx < number_elements; elem_idx++)
+    {
+        std::array<std::int32_t,4> element_box    {};
+        std::uint32_t              element_scale  {};
+        std::uint8_t               static_element {};
+        if (  reader.Read(element_box.data(),sizeof(element_box)) == false || reader.Read(element_scale) == false 
+           || reader.Read(static_element) == false || element_box[2] <= 0 || element_box[3] <= 0 || element_scale == 0
+           || element_box[2] % element_scale != 0 || element_box[3] % element_scale != 0 )
+        {
+            IMPROC_DRAWER_LOGGER_DEBUG("Render plan cache {} is corrupted",this->cache_filepath_);
+            return std::nullopt;
+        }
+        cached_allocation.element_boxes.push_back(cv::Rect(element_box[0],element_box[1],element_box[2],element_box[3]));
+        cached_allocation.element_scales.push_back(element_scale);
+        cached_allocation.static_elements.push_back(static_element != 0);
+    }
+
+    cached_allocation.background = cv::Mat(cached_allocation.page_size,data_type);
+    if (  reader.Read(cached_allocation.background.data,cached_allocation.background.total() * cached_allocation.background.elemSize()) == false
+       || reader.IsAtEnd() == false )
+    {
+        IMPROC_DRAWER_LOGGER_DEBUG("Render plan cache {} is corrupted",this->cache_filepath_);
+        return std::nullopt;
+    }
+    return cached_allocation;
+}
+
+/**
+ * @brief Write page allocation of a render plan to the cache file.
+ * The cache file is replaced atomically, so concurrent readers never see a partially written cache.
+ * Failing to write the cache is not an error, since the page can always be allocated again.
+ *
+ * @param render_plan - render plan of allocated page
+ */
+void improc::RenderPlanCache::Write(const improc::RenderPlan& render_plan) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Writing render plan cache...");
+    cv::Mat background = render_plan.get_background();
+    if (background.isContinuous() == false)
+    {
+        background = background.clone();
+    }
+
+    std::string temporary_filepath = GetTemporaryFilepath(this->cache_filepath_);
+    bool        is_written         = false;
+    {
+        std::ofstream cache_file {temporary_filepath,std::ios::binary | std::ios::trunc};
+        if (cache_file.is_open() == false)
+        {
+            IMPROC_DRAWER_LOGGER_WARN("Render plan cache {} could not be written",this->cache_filepath_);
+            return;
+        }
+        cache_file.write(kCacheMagic.data(),kCacheMagic.size());
+        WriteField(cache_file,improc::RenderPlanCache::kFormatVersion);
+        WriteField(cache_file,kByteOrderMark);
+        WriteField(cache_file,this->key_);
+        WriteField(cache_file,static_cast<std::int32_t>(render_plan.get_page_size().width));
+        WriteField(cache_file,static_cast<std::int32_t>(render_plan.get_page_size().height));
+        WriteField(cache_file,static_cast<std::int32_t>(background.type()));
+        WriteField(cache_file,static_cast<std::uint64_t>(render_plan.get_number_elements()));
+        for (size_t elem_idx = 0; elem_idx < render_plan.get_number_elements(); elem_idx++)
+        {
+            const cv::Rect& element_box = render_plan.get_element_boxes()[elem_idx];
+            std::array<std::int32_t,4> element_box_fields {element_box.x,element_box.y,element_box.width,element_box.height};
+            cache_file.write(reinterpret_cast<const char*>(element_box_fields.data()),sizeof(element_box_fields));
+            WriteField(cache_file,static_cast<std::uint32_t>(render_plan.get_element_scales()[elem_idx]));
+            WriteField(cache_file,static_cast<std::uint8_t>(render_plan.get_static_elements()[elem_idx]));
+        }
+        cache_file.write(reinterpret_cast<const char*>(background.data),background.total() * background.elemSize());
+        cache_file.close();
+        is_written = cache_file.good();
+    }
+
+    std::error_code error_code {};
+    if (is_written == false)
+    {
+        IMPROC_DRAWER_LOGGER_WARN("Render plan cache {} could not be written",this->cache_filepath_);
+        std::filesystem::remove(temporary_filepath,error_code);
+        return;
+    }
+    std::filesystem::rename(temporary_filepath,this->cache_filepath_,error_code);
+    if (error_code)
+    {
+        IMPROC_DRAWER_LOGGER_WARN("Render plan cache {} could not be replaced: {}",this->cache_filepath_,error_code.message());
+        std::filesystem::remove(temporary_filepath,error_code);
+    }
+}
@@ -1,23 +1,46 @@
 #include <improc/drawer/drawer_types/text_drawer.hpp>
 
+namespace
+{
+    /**
+     * @brief FreeType library and face owned by a single thread. 
+     * The face keeps the font data alive while it exists and tracks the font content of the text drawers 
+     * to know when it is no longer used.
+     */
+    class ThreadFontFace final
+    {
+        public:
+            std::weak_ptr<const improc::TextDrawer::FontContent>    font_content;
+            std::shared_ptr<const std::vector<FT_Byte>>             font_data;
+            FT_Library                                              library;
+            FT_Face                                                 face;
+
+            ThreadFontFace() : font_content(), font_data(), library(nullptr), face(nullptr) {};
+            ThreadFontFace(const ThreadFontFace&  that) = delete;
+            ThreadFontFace& operator=(const ThreadFontFace&  that) = delete;
+
+            ~ThreadFontFace()
+            {
+                if (this->face != nullptr)
+                {
+                    FT_Done_Face(this->face);
+                }
+                if (this->library != nullptr)
+                {
+                    FT_Done_FreeType(this->library);
+                }
+            }
+    };
+}
+
 /**
  * @brief Construct a new improc::TextDrawer object
  */
 improc::TextDrawer::TextDrawer(): improc::BaseDrawer()
-                                , font_loaded_(false)
+                                , font_content_(std::shared_ptr<const improc::TextDrawer::FontContent>())
                                 , image_text_size_(cv::Size())
                                 , printing_resolution_(0)
-                                , font_size_(0)
-{
-    IMPROC_DRAWER_LOGGER_TRACE("Initializing FreeType library...");
-    FT_Error error = FT_Init_FreeType(&this->library_);
-    if (error != FT_Err_Ok)
-    {
-        std::string error_message = fmt::format("Error initializing FreeType with code {}",error);
-        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
-        throw improc::freetype_error(std::move(error_message));
-    }
-};
+                                , font_size_(0) {};
 
 /**
  * @brief Construct a new improc::TextDrawer object
@@ -69,14 +92,13 @@ improc::TextDrawer& improc::TextDrawer::Load(const Json::Value& drawer_json)
     this->image_text_size_     = improc::TextDrawer::ParseMetricSize(drawer_json[kImageTextSizeKey],improc::MetricPixelConverter(this->printing_resolution_));
     
     improc::File font_file {drawer_json[kFontPathKey],improc::ApplicationContext::get()->get_application_folder()};
-    FT_Error error_font = FT_New_Face(this->library_,font_file.get_filepath().c_str(),improc::TextDrawer::kLoadFirstFont,&this->face_);
-    if (error_font != FT_Err_Ok)
+    std::ifstream font_stream {font_file.get_filepath(),std::ios::binary};
+    if (font_stream.is_open() == false)
     {
-        std::string error_message = fmt::format("Error loading face font from {} with code {}",font_file.get_filepath(),error_font);
+        std::string error_message = fmt::format("Error reading font file {}",font_file.get_filepath());
         IMPROC_DRAWER_LOGGER_ERROR("ERROR_05: " + error_message);
         throw improc::freetype_error(std::move(error_message));
     }
-    this->font_loaded_  = true;
 
     unsigned int font_size = improc::json::ReadElement<unsigned int>(drawer_json[kFontSizeKey]);
     if (font_size == 0)
@@ -86,19 +108,74 @@ improc::TextDrawer& improc::TextDrawer::Load(const Json::Value& drawer_json)
         throw improc::value_error(std::move(error_message));
     }
     this->font_size_ = std::move(font_size);
+    this->font_content_ = std::make_shared<const improc::TextDrawer::FontContent>
+        ( improc::TextDrawer::FontContent   { std::make_shared<const std::vector<FT_Byte>>( std::istreambuf_iterator<char>(font_stream)
+                                                                                          , std::istreambuf_iterator<char>() ) } );
+
+    // Create the face of the loading thread to validate font content and size
+    this->GetFontFace();
+    return (*this);
+};
 
-    FT_Error error_char_size = FT_Set_Char_Size ( this->face_
+/**
+ * @brief Obtain FreeType face of the calling thread for the loaded font
+ * 
+ * FreeType libraries and faces are created once per thread and font content. Faces of fonts that 
+ * are no longer used by any text drawer are released when a new face is created in the same thread.
+ * 
+ * @return FT_Face - font face owned by the calling thread
+ */
+FT_Face improc::TextDrawer::GetFontFace() const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining font face for thread...");
+    thread_local std::unordered_map<const improc::TextDrawer::FontContent*,std::unique_ptr<ThreadFontFace>> thread_faces {};
+    auto thread_face = thread_faces.find(this->font_content_.get());
+    if (thread_face != thread_faces.end() && thread_face->second->font_content.expired() == false)
+    {
+        return thread_face->second->face;
+    }
+
+    for (auto face_iter = thread_faces.begin(); face_iter != thread_faces.end(); )
+    {
+        face_iter = face_iter->second->font_content.expired() == true ? thread_faces.erase(face_iter) : std::next(face_iter);
+    }
+
+    std::unique_ptr<ThreadFontFace> font_face = std::make_unique<ThreadFontFace>();
+    font_face->font_content = this->font_content_;
+    font_face->font_data    = this->font_content_->data;
+    FT_Error error = FT_Init_FreeType(&font_face->library);
+    if (error != FT_Err_Ok)
+    {
+        std::string error_message = fmt::format("Error initializing FreeType with code {}",error);
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::freetype_error(std::move(error_message));
+    }
+
+    FT_Error error_font = FT_New_Memory_Face( font_face->library
+                                            , font_face->font_data->data(), static_cast<FT_Long>(font_face->font_data->size())
+                                            , improc::TextDrawer::kLoadFirstFont, &font_face->face );
+    if (error_font != FT_Err_Ok)
+    {
+        std::string error_message = fmt::format("Error loading face font with code {}",error_font);
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_02: " + error_message);
+        throw improc::freetype_error(std::move(error_message));
+    }
+
+    FT_Error error_char_size = FT_Set_Char_Size ( font_face->face
                                                 , this->font_size_ * improc::TextDrawer::kFontSizePointFraction
                                                 , this->font_size_ * improc::TextDrawer::kFontSizePointFraction
                                                 , this->printing_resolution_, this->printing_resolution_ );
     if (error_char_size != FT_Err_Ok)
     {
         std::string error_message = fmt::format("Error defining face font size with code {}",error_char_size);
-        IMPROC_DRAWER_LOGGER_ERROR("ERROR_07: " + error_message);
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_03: " + error_message);
         throw improc::freetype_error(std::move(error_message));
     }
-    return (*this);
-};
+
+    FT_Face face = font_face->face;
+    thread_faces[this->font_content_.get()] = std::move(font_face);
+    return face;
+}
 
 /**
  * @brief Parse metric size
@@ -132,24 +209,58 @@ cv::Size improc::TextDrawer::ParseMetricSize(const Json::Value& size_json, const
  * @param message - message to draw
  * @return cv::Mat - image with message
  */
-cv::Mat improc::TextDrawer::Draw(const std::optional<improc::DrawerVariant>& message)
+cv::Mat improc::TextDrawer::Draw(const std::optional<improc::DrawerVariant>& message) const
 {
     IMPROC_DRAWER_LOGGER_TRACE("Drawing text...");
-    if (this->font_loaded_ == false)
+    cv::Mat text_image (this->image_text_size_,improc::BaseDrawer::kImageDataType);
+    this->DrawInto(text_image,std::move(message));
+    return text_image;
+};
+
+/**
+ * @brief Obtain size of text image, which is defined by the configuration and does not depend on the message
+ * 
+ * @param message - message to draw
+ * @return cv::Size - size of text image
+ */
+cv::Size improc::TextDrawer::GetOutputSize(const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining text size...");
+    if (this->font_content_ == nullptr)
     {
         std::string error_message = "Font not loaded for text drawer";
         IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
         throw improc::value_error(std::move(error_message));
     }
+    return this->image_text_size_;
+}
 
-    cv::Mat text_image (this->image_text_size_,improc::BaseDrawer::kImageDataType,improc::BaseDrawer::kWhiteValue);
-    IMPROC_DRAWER_LOGGER_DEBUG("Text image with size width = {}, height = {}", text_image.cols, text_image.rows);
+/**
+ * @brief Draw text directly in a region of interest
+ * 
+ * @param roi - region of interest with the size of the text image
+ * @param message - text to be drawed
+ */
+void improc::TextDrawer::DrawInto(cv::Mat& roi, const std::optional<improc::DrawerVariant>& message) const
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Drawing text into region of interest...");
+    if (this->font_content_ == nullptr)
+    {
+        std::string error_message = "Font not loaded for text drawer";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    improc::BaseDrawer::ValidateRoi(roi,this->image_text_size_);
+    roi.setTo(improc::BaseDrawer::kWhiteValue);
+    IMPROC_DRAWER_LOGGER_DEBUG("Text image with size width = {}, height = {}", roi.cols, roi.rows);
     std::string message_data = std::get<std::string>(message.value());
+    FT_Face face = this->GetFontFace();
     FT_Pos position_x = 0;
     std::for_each   ( message_data.begin(),message_data.end()
-                    , [this,&text_image,&position_x] (const FT_ULong& char_code)
+                    , [this,&face,&roi,&position_x] (const FT_ULong& char_code)
                         {
-                            FT_Error error = FT_Load_Char(this->face_,char_code,FT_LOAD_RENDER);
+                            FT_Error error = FT_Load_Char(face,char_code,FT_LOAD_RENDER);
                             if(error != FT_Err_Ok)
                             {
                                 std::string error_message = fmt::format("Error rendering character {} with code {}",char_code,error);
@@ -157,21 +268,20 @@ cv::Mat improc::TextDrawer::Draw(const std::optional<improc::DrawerVariant>& mes
                                 throw improc::freetype_error(std::move(error_message));
                             }
 
-                            FT_Bitmap char_bitmap = this->face_->glyph->bitmap;
+                            FT_Bitmap char_bitmap = face->glyph->bitmap;
                             cv::Mat char_image (char_bitmap.rows,char_bitmap.width,improc::TextDrawer::kImageDataType,char_bitmap.buffer);
                             IMPROC_DRAWER_LOGGER_DEBUG  ( "Drawing char in x = {}, y = {} with size width = {}, height = {}"
                                                         , position_x, this->image_text_size_.height - char_image.rows, char_image.cols, char_image.rows);
                             if (char_image.empty() == false)
                             {
-                                char_image = improc::BaseDrawer::kWhiteValue - char_image;
-                                char_image.copyTo(text_image(cv::Rect(position_x,this->image_text_size_.height - char_image.rows,char_image.cols,char_image.rows)));
+                                cv::Mat char_roi = roi(cv::Rect(position_x,this->image_text_size_.height - char_image.rows,char_image.cols,char_image.rows));
+                                cv::subtract(cv::Scalar(improc::BaseDrawer::kWhiteValue),char_image,char_roi);
                             }
                             else
                             {
                                 IMPROC_DRAWER_LOGGER_WARN("Char {} was not drawed in text drawer", char_code);                         
                             }
-                            position_x += this->face_->glyph->advance.x / static_cast<signed long>(improc::TextDrawer::kFontSizePointFraction);                            
+                            position_x += face->glyph->advance.x / static_cast<signed long>(improc::TextDrawer::kFontSizePointFraction);                            
                         }
                     );
-    return text_image;
-};
+}
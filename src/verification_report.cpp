@@ -0,0 +1,56 @@
+#include <improc/drawer/engine/verification_report.hpp>
+
+#include <algorithm>
+
+/**
+ * @brief Construct a new empty improc::VerificationReport object
+ */
+improc::VerificationReport::VerificationReport() : element_results_(std::vector<improc::VerificationReport::ElementResult>())
+                                                 , duration_(std::chrono::nanoseconds::zero()) {};
+
+/**
+ * @brief Construct a new improc::VerificationReport object
+ *
+ * @param element_results - verification results of page elements, in page order
+ * @param duration - verification time of page
+ */
+improc::VerificationReport::VerificationReport(std::vector<improc::VerificationReport::ElementResult>&& element_results, std::chrono::nanoseconds duration)
+    : element_results_(std::move(element_results))
+    , duration_(std::move(duration)) {};
+
+/**
+ * @brief Check if no verified page element failed.
+ * Fail fast verification only skips page elements after a failure, so a valid report has every page element verified.
+ *
+ * @return bool - true if page is correct, false otherwise.
+ */
+bool improc::VerificationReport::IsValid() const
+{
+    return std::none_of ( this->element_results_.begin(),this->element_results_.end()
+                        , [] (const improc::VerificationReport::ElementResult& result) {return result.is_verified == true && result.is_valid == false;} );
+}
+
+/**
+ * @brief Obtain number of verified page elements
+ */
+size_t improc::VerificationReport::GetNumberVerified() const
+{
+    return std::count_if( this->element_results_.begin(),this->element_results_.end()
+                        , [] (const improc::VerificationReport::ElementResult& result) {return result.is_verified;} );
+}
+
+/**
+ * @brief Obtain indexes of verified page elements that failed verification
+ */
+std::vector<size_t> improc::VerificationReport::GetInvalidElements() const
+{
+    std::vector<size_t> invalid_elements {};
+    for (size_t elem_idx = 0; elem_idx < this->element_results_.size(); elem_idx++)
+    {
+        if (this->element_results_[elem_idx].is_verified == true && this->element_results_[elem_idx].is_valid == false)
+        {
+            invalid_elements.push_back(elem_idx);
+        }
+    }
+    return invalid_elements;
+}
@@ -0,0 +1,20 @@
+#include <improc/drawer/engine/verify_effort.hpp>
+
+/**
+ * @brief Construct a new improc::VerifyEffort object
+ */
+improc::VerifyEffort::VerifyEffort() : value_(improc::VerifyEffort::kPure) {};
+
+/**
+ * @brief Construct a new improc::VerifyEffort object
+ * 
+ * @param verify_effort_str - verify effort description as string
+ */
+improc::VerifyEffort::VerifyEffort(const std::string& verify_effort_str)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Obtaining verify effort from string {}...",verify_effort_str);
+    static const std::unordered_map<std::string,VerifyEffort::Value> kToVerifyEffort = { {"pure"  ,VerifyEffort::Value::kPure  }
+                                                                                       , {"robust",VerifyEffort::Value::kRobust}
+                                                                                       };
+    this->value_ = kToVerifyEffort.at(improc::String::ToLower(std::move(verify_effort_str)));
+}
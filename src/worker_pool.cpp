@@ -0,0 +1,169 @@
+#include <improc/drawer/engine/worker_pool.hpp>
+
+#include <atomic>
+
+namespace
+{
+    /**
+     * @brief Shared state of the tasks submitted in a single call to improc::WorkerPool::Run
+     */
+    struct WorkerPoolBatch
+    {
+        const std::function<void(size_t)>*  task;
+        size_t                              number_tasks;
+        std::atomic<size_t>                 next_task;
+        std::atomic<size_t>                 finished_tasks;
+        std::mutex                          mutex;
+        std::condition_variable             condition;
+        std::exception_ptr                  error;
+    };
+
+    /**
+     * @brief Execute tasks from batch until there are no more tasks to start
+     *
+     * @param batch - shared state of the tasks
+     */
+    void ExecuteBatch(WorkerPoolBatch& batch)
+    {
+        for (size_t task_idx = batch.next_task.fetch_add(1); task_idx < batch.number_tasks; task_idx = batch.next_task.fetch_add(1))
+        {
+            try
+            {
+                (*batch.task)(task_idx);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock {batch.mutex};
+                if (batch.error == nullptr)
+                {
+                    batch.error = std::current_exception();
+                }
+            }
+            if (batch.finished_tasks.fetch_add(1) + 1 == batch.number_tasks)
+            {
+                std::lock_guard<std::mutex> lock {batch.mutex};
+                batch.condition.notify_all();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Construct a new improc::WorkerPool object with one worker per hardware thread
+ */
+improc::WorkerPool::WorkerPool() : improc::WorkerPool(std::max(std::thread::hardware_concurrency(),1U)) {};
+
+/**
+ * @brief Construct a new improc::WorkerPool object
+ *
+ * @param number_workers - number of threads executing tasks, including the calling thread
+ */
+improc::WorkerPool::WorkerPool(unsigned int number_workers) : workers_(std::vector<std::thread>())
+                                                            , jobs_(std::deque<std::function<void()>>())
+                                                            , stopping_(false)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Creating worker pool...");
+    if (number_workers == 0)
+    {
+        std::string error_message = "Number of workers should be greater than zero";
+        IMPROC_DRAWER_LOGGER_ERROR("ERROR_01: " + error_message);
+        throw improc::value_error(std::move(error_message));
+    }
+
+    IMPROC_DRAWER_LOGGER_DEBUG("Creating worker pool with {} workers",number_workers);
+    this->workers_.reserve(number_workers - 1);
+    for (unsigned int worker_idx = 1; worker_idx < number_workers; worker_idx++)
+    {
+        this->workers_.emplace_back(&improc::WorkerPool::Work,this);
+    }
+}
+
+/**
+ * @brief Destroy the improc::WorkerPool object
+ */
+improc::WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock {this->jobs_mutex_};
+        this->stopping_ = true;
+    }
+    this->jobs_condition_.notify_all();
+    std::for_each(this->workers_.begin(),this->workers_.end(),[] (std::thread& worker) {worker.join();});
+}
+
+/**
+ * @brief Obtain default worker pool with one worker per hardware thread. 
+ * The default worker pool is created on first use and kept until the program exits, so repeated calls do not 
+ * create threads again.
+ */
+improc::WorkerPool& improc::WorkerPool::GetDefault()
+{
+    static improc::WorkerPool default_worker_pool {};
+    return default_worker_pool;
+}
+
+/**
+ * @brief Execute jobs submitted to the worker pool until the pool is destroyed
+ */
+void improc::WorkerPool::Work()
+{
+    while (true)
+    {
+        std::function<void()> job {};
+        {
+            std::unique_lock<std::mutex> lock {this->jobs_mutex_};
+            this->jobs_condition_.wait(lock,[this] () {return this->stopping_ == true || this->jobs_.empty() == false;});
+            if (this->jobs_.empty() == true)
+            {
+                return;
+            }
+            job = std::move(this->jobs_.front());
+            this->jobs_.pop_front();
+        }
+        job();
+    }
+}
+
+/**
+ * @brief Execute indexed tasks in the worker pool and wait for their completion
+ *
+ * @param number_tasks - number of tasks to execute
+ * @param task - task to execute, receiving the task index between 0 and number_tasks - 1
+ */
+void improc::WorkerPool::Run(size_t number_tasks, const std::function<void(size_t)>& task)
+{
+    IMPROC_DRAWER_LOGGER_TRACE("Running {} tasks in worker pool...",number_tasks);
+    if (number_tasks == 0)
+    {
+        return;
+    }
+
+    std::shared_ptr<WorkerPoolBatch> batch = std::make_shared<WorkerPoolBatch>();
+    batch->task           = &task;
+    batch->number_tasks   = number_tasks;
+    batch->next_task      = 0;
+    batch->finished_tasks = 0;
+
+    // Helpers that start after every task was taken exit without touching the task, so the caller
+    // only waits for the completion of tasks and never for idle helpers queued behind other jobs.
+    size_t number_helpers = std::min(this->workers_.size(),number_tasks - 1);
+    if (number_helpers > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock {this->jobs_mutex_};
+            for (size_t helper_idx = 0; helper_idx < number_helpers; helper_idx++)
+            {
+                this->jobs_.emplace_back([batch] () {ExecuteBatch(*batch);});
+            }
+        }
+        this->jobs_condition_.notify_all();
+    }
+    ExecuteBatch(*batch);
+
+    std::unique_lock<std::mutex> lock {batch->mutex};
+    batch->condition.wait(lock,[&batch] () {return batch->finished_tasks.load() == batch->number_tasks;});
+    if (batch->error != nullptr)
+    {
+        std::rethrow_exception(batch->error);
+    }
+}
\ No newline at end of file
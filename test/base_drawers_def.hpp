@@ -3,6 +3,8 @@
 
 #include <improc/drawer/engine/page_drawer.hpp>
 
+#include <atomic>
+
 class TestPageDrawer : public improc::BaseDrawer
 {
     public:
@@ -17,12 +19,12 @@ class TestPageDrawer : public improc::BaseDrawer
             return (*this);
         }
 
-        cv::Mat     Draw(const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) 
+        cv::Mat     Draw(const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
         {
             return cv::Mat::zeros(50,100,CV_8UC1);
         }
 
-        bool        Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>())
+        bool        Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
         {
             return drawer_output.rows == 50 && drawer_output.cols == 100;
         }
@@ -42,12 +44,12 @@ class TestPageElemDrawer : public improc::BaseDrawer
             return (*this);
         }
 
-        cv::Mat     Draw(const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>())
+        cv::Mat     Draw(const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
         {
             return 255 * cv::Mat::ones(50,100,CV_8UC1);
         }
 
-        bool        Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>())
+        bool        Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
         {
             return drawer_output.rows == 50 && drawer_output.cols == 100;
         }
@@ -67,12 +69,12 @@ class TestDrawer : public improc::BaseDrawer
             return (*this);
         }
 
-        cv::Mat     Draw(const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) 
+        cv::Mat     Draw(const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
         {
             return cv::Mat::ones(10,20,CV_8UC1);
         }
 
-        bool        Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>())
+        bool        Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
         {
             return drawer_output.rows == 10 && drawer_output.cols == 20;
         }
@@ -92,18 +94,131 @@ class TestDrawerWithMessage : public improc::BaseDrawer
             return (*this);
         }
 
-        cv::Mat     Draw(const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) 
+        cv::Mat     Draw(const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
         {
             std::cout << std::get<std::string>(message.value()) << std::endl;
             return cv::Mat::ones(10,20,CV_8UC1);
         }
 
-        bool        Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>())
+        bool        Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
         {
             return drawer_output.rows == 10 && drawer_output.cols == 20;
         }
 };
 
+class TestPatternDrawer : public improc::BaseDrawer
+{
+    public:
+        TestPatternDrawer() {};
+        explicit TestPatternDrawer(const Json::Value& drawer_json)
+        {
+            this->Load(drawer_json);
+        }
+
+        TestPatternDrawer& Load(const Json::Value& drawer_json)
+        {
+            return (*this);
+        }
+
+        cv::Mat     Draw(const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
+        {
+            cv::Mat pattern (10,20,CV_8UC1);
+            for (int pixel_y = 0; pixel_y < pattern.rows; pixel_y++)
+            {
+                for (int pixel_x = 0; pixel_x < pattern.cols; pixel_x++)
+                {
+                    pattern.at<uint8_t>(pixel_y,pixel_x) = static_cast<uint8_t>(pixel_y * pattern.cols + pixel_x);
+                }
+            }
+            return pattern;
+        }
+
+        bool        Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
+        {
+            return cv::norm(drawer_output,this->Draw(),cv::NORM_L1) == 0;
+        }
+};
+
+class TestMessageDrawer : public improc::BaseDrawer
+{
+    public:
+        TestMessageDrawer() {};
+        explicit TestMessageDrawer(const Json::Value& drawer_json)
+        {
+            this->Load(drawer_json);
+        }
+
+        TestMessageDrawer& Load(const Json::Value& drawer_json)
+        {
+            return (*this);
+        }
+
+        cv::Mat     Draw(const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
+        {
+            double value = message.has_value() == true ? static_cast<double>(std::get<std::string>(message.value()).size()) : 0.0;
+            return cv::Mat(10,20,CV_8UC1,cv::Scalar(value));
+        }
+
+        bool        Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
+        {
+            return cv::norm(drawer_output,this->Draw(message),cv::NORM_L1) == 0;
+        }
+};
+
+class TestUndecodableDrawer : public TestMessageDrawer
+{
+    public:
+        TestUndecodableDrawer() {};
+        explicit TestUndecodableDrawer(const Json::Value& drawer_json) : TestMessageDrawer(drawer_json) {}
+
+        bool        Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
+        {
+            return false;
+        }
+};
+
+class TestCountingDrawer : public TestUndecodableDrawer
+{
+    public:
+        inline static std::atomic<size_t> number_draws {0};
+
+        TestCountingDrawer() {};
+        explicit TestCountingDrawer(const Json::Value& drawer_json) : TestUndecodableDrawer(drawer_json) {}
+
+        cv::Mat     Draw(const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
+        {
+            number_draws++;
+            return TestUndecodableDrawer::Draw(message);
+        }
+};
+
+class TestSizedMessageDrawer : public improc::BaseDrawer
+{
+    public:
+        TestSizedMessageDrawer() {};
+        explicit TestSizedMessageDrawer(const Json::Value& drawer_json)
+        {
+            this->Load(drawer_json);
+        }
+
+        TestSizedMessageDrawer& Load(const Json::Value& drawer_json)
+        {
+            return (*this);
+        }
+
+        cv::Mat     Draw(const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
+        {
+            int size = message.has_value() == true ? static_cast<int>(std::get<std::string>(message.value()).size()) : 5;
+            return cv::Mat(size,size,CV_8UC1,cv::Scalar(255));
+        }
+
+        bool        Verify(const cv::Mat& drawer_output, const std::optional<improc::DrawerVariant>& message = std::optional<improc::DrawerVariant>()) const
+        {
+            cv::Mat expected_output = this->Draw(message);
+            return drawer_output.size() == expected_output.size() && cv::norm(drawer_output,expected_output,cv::NORM_L1) == 0;
+        }
+};
+
 typedef TestPageDrawer  TestPageDrawer;
 typedef TestPageDrawer  TestGridDrawer;
 typedef TestPageDrawer  TestLayoutDrawer;
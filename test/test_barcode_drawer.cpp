@@ -5,6 +5,8 @@
 #include <improc/drawer/drawer_types/barcode_drawer.hpp>
 #include <improc/infrastructure/filesystem/file.hpp>
 
+#include <opencv2/imgproc.hpp>
+
 TEST(BarcodeDrawer,TestConstructor) {
     EXPECT_NO_THROW(improc::BarcodeDrawer());
 }
@@ -42,3 +44,58 @@ TEST(BarcodeDrawer,TestDraw) {
     EXPECT_TRUE(drawer.Verify(test_mat,"test_message"));
     EXPECT_FALSE(drawer.Verify(false_mat,"test_message"));
 }
+
+TEST(BarcodeDrawer,TestDrawInto) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/barcode_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::BarcodeDrawer drawer {};
+    drawer.Load(json_content);
+    cv::Mat page = cv::Mat::zeros(10 + 10,167 + 10,CV_8UC1);
+    cv::Mat roi  = page(cv::Rect(5,5,167,10));
+    drawer.DrawInto(roi,"test_message");
+    EXPECT_EQ(cv::norm(roi,drawer.Draw("test_message"),cv::NORM_L1),0);
+    EXPECT_TRUE(drawer.Verify(roi.clone(),"test_message"));
+    cv::Mat invalid_roi = page(cv::Rect(0,0,167 - 1,10));
+    EXPECT_THROW(drawer.DrawInto(invalid_roi,"test_message"),improc::value_error);
+}
+
+TEST(BarcodeDrawer,TestGetOutputSize) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/barcode_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::BarcodeDrawer drawer {json_content};
+    EXPECT_EQ(drawer.GetOutputSize("test_message"),cv::Size(167,10));
+    EXPECT_EQ(drawer.GetOutputSize("another_test_message"),drawer.Draw("another_test_message").size());
+}
+
+TEST(BarcodeDrawer,TestVerifyEffort) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/barcode_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::BarcodeDrawer pure_drawer {json_content};
+    EXPECT_EQ(pure_drawer.get_verify_effort(),improc::VerifyEffort::kPure);
+    json_content["verify-effort"] = "robust";
+    improc::BarcodeDrawer robust_drawer {json_content};
+    EXPECT_EQ(robust_drawer.get_verify_effort(),improc::VerifyEffort::kRobust);
+
+    for (const std::string& message : {"1","test_message","another_test_message"})
+    {
+        cv::Mat barcode = pure_drawer.Draw(message);
+        EXPECT_TRUE(pure_drawer.Verify(barcode,message));
+        EXPECT_TRUE(pure_drawer.Verify(barcode.row(0).clone(),message));
+        EXPECT_FALSE(pure_drawer.Verify(barcode,"other_message"));
+
+        cv::Mat scan_image (barcode.rows * 2 + 40,barcode.cols * 2 + 40,CV_8UC1,cv::Scalar(255));
+        cv::Mat scan_roi = scan_image(cv::Rect(20,20,barcode.cols * 2,barcode.rows * 2));
+        cv::resize(barcode,scan_roi,scan_roi.size(),0,0,cv::INTER_NEAREST);
+        EXPECT_TRUE(robust_drawer.Verify(scan_image,message));
+        EXPECT_FALSE(robust_drawer.Verify(scan_image,"other_message"));
+    }
+}
+
+TEST(BarcodeDrawer,TestInvalidVerifyEffort) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/barcode_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    json_content["verify-effort"] = "invalid";
+    EXPECT_THROW(improc::BarcodeDrawer {json_content},std::out_of_range);
+    improc::BarcodeDrawer drawer {};
+    EXPECT_THROW(drawer.Load(json_content),std::out_of_range);
+}
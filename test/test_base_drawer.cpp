@@ -30,6 +30,27 @@ TEST(BaseDrawer,TestDraw) {
     EXPECT_FALSE(test.Verify(cv::Mat::ones(20,20,CV_8UC1)));
 }
 
+TEST(BaseDrawer,TestDrawInto) {
+    TestDrawer test {};
+    cv::Mat page = cv::Mat::zeros(30,40,CV_8UC1);
+    cv::Mat roi  = page(cv::Rect(5,10,20,10));
+    test.DrawInto(roi);
+    EXPECT_EQ(roi.data,page.ptr<uint8_t>(10) + 5);
+    EXPECT_EQ(cv::norm(roi,test.Draw(),cv::NORM_L1),0);
+    EXPECT_EQ(cv::countNonZero(page),200);
+}
+
+TEST(BaseDrawer,TestDrawIntoInvalidSize) {
+    TestDrawer test {};
+    cv::Mat roi = cv::Mat::zeros(20,20,CV_8UC1);
+    EXPECT_THROW(test.DrawInto(roi),improc::value_error);
+}
+
+TEST(BaseDrawer,TestGetOutputSize) {
+    TestDrawer test {};
+    EXPECT_EQ(test.GetOutputSize(),cv::Size(20,10));
+}
+
 TEST(DrawerFactory,TestConstructor) {
     EXPECT_EQ(improc::DrawerFactory().GetRegisteredIds().size(),0);
 }
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <improc/drawer/engine/bounded_queue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST(BoundedQueue,TestConstructor) {
+    EXPECT_NO_THROW(improc::BoundedQueue<int>(4));
+    EXPECT_EQ(improc::BoundedQueue<int>(4).get_capacity(),4);
+}
+
+TEST(BoundedQueue,TestInvalidCapacity) {
+    EXPECT_THROW(improc::BoundedQueue<int>(0),improc::value_error);
+}
+
+TEST(BoundedQueue,TestEmptyPop) {
+    improc::BoundedQueue<int> queue {2};
+    EXPECT_FALSE(queue.TryPop().has_value());
+}
+
+TEST(BoundedQueue,TestFullPush) {
+    improc::BoundedQueue<int> queue {2};
+    EXPECT_TRUE(queue.TryPush(1));
+    EXPECT_TRUE(queue.TryPush(2));
+    EXPECT_FALSE(queue.TryPush(3));
+    EXPECT_EQ(queue.TryPop().value(),1);
+    EXPECT_TRUE(queue.TryPush(3));
+    EXPECT_EQ(queue.TryPop().value(),2);
+    EXPECT_EQ(queue.TryPop().value(),3);
+    EXPECT_FALSE(queue.TryPop().has_value());
+}
+
+TEST(BoundedQueue,TestConcurrentPushPop) {
+    static constexpr int kNumberElements = 10000;
+    improc::BoundedQueue<int> queue {8};
+    std::atomic<long long> sum {0};
+    std::atomic<int> number_popped {0};
+    std::thread producer {[&queue] ()
+        {
+            for (int elem = 1; elem <= kNumberElements; elem++)
+            {
+                while (queue.TryPush(int(elem)) == false)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    };
+    std::vector<std::thread> consumers {};
+    for (size_t consumer_idx = 0; consumer_idx < 3; consumer_idx++)
+    {
+        consumers.emplace_back([&queue,&sum,&number_popped] ()
+            {
+                while (number_popped.load() < kNumberElements)
+                {
+                    std::optional<int> elem = queue.TryPop();
+                    if (elem.has_value() == true)
+                    {
+                        sum += elem.value();
+                        number_popped++;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        );
+    }
+    producer.join();
+    for (std::thread& consumer : consumers)
+    {
+        consumer.join();
+    }
+    EXPECT_EQ(number_popped.load(),kNumberElements);
+    EXPECT_EQ(sum.load(),static_cast<long long>(kNumberElements) * (kNumberElements + 1) / 2);
+}
+
+TEST(BoundedQueue,TestBlockingPushPop) {
+    static constexpr int kNumberElements = 10000;
+    improc::BoundedQueue<int> queue {4};
+    long long sum = 0;
+    std::thread consumer {[&queue,&sum] ()
+        {
+            for (std::optional<int> elem = queue.Pop(); elem.has_value() == true; elem = queue.Pop())
+            {
+                sum += elem.value();
+            }
+        }
+    };
+    for (int elem = 1; elem <= kNumberElements; elem++)
+    {
+        EXPECT_TRUE(queue.Push(int(elem)));
+    }
+    queue.Close();
+    consumer.join();
+    EXPECT_EQ(sum,static_cast<long long>(kNumberElements) * (kNumberElements + 1) / 2);
+    EXPECT_FALSE(queue.Push(1));
+}
+
+TEST(BoundedQueue,TestCloseWakesWaitingPop) {
+    improc::BoundedQueue<int> queue {2};
+    std::thread consumer {[&queue] () {EXPECT_FALSE(queue.Pop().has_value());}};
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    queue.Close();
+    consumer.join();
+
+    improc::BoundedQueue<int> closed_queue {2};
+    EXPECT_TRUE(closed_queue.TryPush(1));
+    closed_queue.Close();
+    EXPECT_EQ(closed_queue.Pop().value(),1);
+    EXPECT_FALSE(closed_queue.Pop().has_value());
+}
@@ -5,6 +5,8 @@
 #include <improc/drawer/drawer_types/data_matrix_drawer.hpp>
 #include <improc/infrastructure/filesystem/file.hpp>
 
+#include <opencv2/imgproc.hpp>
+
 TEST(DataMatrixDrawer,TestConstructor) {
     EXPECT_NO_THROW(improc::DataMatrixDrawer());
 }
@@ -42,3 +44,59 @@ TEST(DataMatrixDrawer,TestDraw) {
     EXPECT_TRUE(drawer.Verify(test_mat,"test_message"));
     EXPECT_FALSE(drawer.Verify(false_mat,"test_message"));
 }
+
+TEST(DataMatrixDrawer,TestDrawInto) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/data_matrix_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DataMatrixDrawer drawer {};
+    drawer.Load(json_content);
+    cv::Mat page = cv::Mat::zeros(16 + 10,16 + 10,CV_8UC1);
+    cv::Mat roi  = page(cv::Rect(5,5,16,16));
+    drawer.DrawInto(roi,"test_message");
+    EXPECT_EQ(cv::norm(roi,drawer.Draw("test_message"),cv::NORM_L1),0);
+    EXPECT_TRUE(drawer.Verify(roi.clone(),"test_message"));
+    cv::Mat invalid_roi = page(cv::Rect(0,0,16 - 1,16));
+    EXPECT_THROW(drawer.DrawInto(invalid_roi,"test_message"),improc::value_error);
+}
+
+TEST(DataMatrixDrawer,TestGetOutputSize) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/data_matrix_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DataMatrixDrawer drawer {json_content};
+    EXPECT_EQ(drawer.GetOutputSize("test_message"),cv::Size(16,16));
+    EXPECT_EQ(drawer.GetOutputSize("another_test_message"),drawer.Draw("another_test_message").size());
+}
+
+TEST(DataMatrixDrawer,TestVerifyEffort) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/data_matrix_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DataMatrixDrawer pure_drawer {json_content};
+    EXPECT_EQ(pure_drawer.get_verify_effort(),improc::VerifyEffort::kPure);
+    json_content["verify-effort"] = "robust";
+    improc::DataMatrixDrawer robust_drawer {json_content};
+    EXPECT_EQ(robust_drawer.get_verify_effort(),improc::VerifyEffort::kRobust);
+
+    // Symbols of different sizes are verified in turn, so the bit matrix kept per thread is resized between them.
+    for (const std::string& message : {"1","test_message","another_test_message","test_message"})
+    {
+        cv::Mat data_matrix = pure_drawer.Draw(message);
+        EXPECT_TRUE(pure_drawer.Verify(data_matrix,message));
+        EXPECT_FALSE(pure_drawer.Verify(data_matrix,"other_message"));
+
+        cv::Mat scan_image (data_matrix.rows * 4 + 16,data_matrix.cols * 4 + 16,CV_8UC1,cv::Scalar(255));
+        cv::Mat scan_roi = scan_image(cv::Rect(8,8,data_matrix.cols * 4,data_matrix.rows * 4));
+        cv::resize(data_matrix,scan_roi,scan_roi.size(),0,0,cv::INTER_NEAREST);
+        EXPECT_TRUE(robust_drawer.Verify(scan_image,message));
+        EXPECT_FALSE(robust_drawer.Verify(scan_image,"other_message"));
+        EXPECT_FALSE(pure_drawer.Verify(scan_image,message));
+    }
+}
+
+TEST(DataMatrixDrawer,TestInvalidVerifyEffort) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/data_matrix_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    json_content["verify-effort"] = "invalid";
+    EXPECT_THROW(improc::DataMatrixDrawer {json_content},std::out_of_range);
+    improc::DataMatrixDrawer drawer {};
+    EXPECT_THROW(drawer.Load(json_content),std::out_of_range);
+}
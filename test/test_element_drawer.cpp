@@ -96,3 +96,127 @@ TEST(ElementDrawer,TestDrawWithTransforms) {
     EXPECT_TRUE(drawer.Verify(test_mat));
     EXPECT_FALSE(drawer.Verify(false_mat));
 }
+
+TEST(ElementDrawer,TestDrawIntoWithoutTransforms) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("increment",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestDrawer>});
+    improc::ElementDrawer drawer = improc::ElementDrawer(factory,json_content);
+    cv::Mat page = cv::Mat::zeros(50,50,CV_8UC1);
+    cv::Mat roi  = page(cv::Rect(10,10,20,10));
+    drawer.DrawInto(roi);
+    EXPECT_EQ(cv::norm(roi,drawer.Draw(),cv::NORM_L1),0);
+    EXPECT_TRUE(drawer.Verify(roi));
+}
+
+TEST(ElementDrawer,TestDrawIntoWithTransforms) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/element_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestDrawer>});
+    improc::ElementDrawer drawer = improc::ElementDrawer(factory,json_content);
+    cv::Mat page = cv::Mat::zeros(50,50,CV_8UC1);
+    cv::Mat roi  = page(cv::Rect(10,5,20,40));
+    drawer.DrawInto(roi);
+    EXPECT_EQ(cv::norm(roi,drawer.Draw(),cv::NORM_L1),0);
+    EXPECT_TRUE(drawer.Verify(roi));
+    cv::Mat invalid_roi = page(cv::Rect(0,0,20,20));
+    EXPECT_THROW(drawer.DrawInto(invalid_roi),improc::value_error);
+}
+
+TEST(ElementDrawer,TestDrawScaledPattern) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/element_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPatternDrawer>});
+    improc::ElementDrawer drawer = improc::ElementDrawer(factory,json_content);
+    cv::Mat expected_mat {};
+    cv::resize(improc::RotationType("90-deg").Apply(TestPatternDrawer().Draw()),expected_mat,cv::Size(),2,2,cv::INTER_NEAREST);
+    cv::Mat test_mat = drawer.Draw();
+    EXPECT_EQ(test_mat.rows,40);
+    EXPECT_EQ(test_mat.cols,20);
+    EXPECT_EQ(cv::norm(test_mat,expected_mat,cv::NORM_L1),0);
+    EXPECT_TRUE(drawer.Verify(test_mat));
+
+    cv::Mat page = cv::Mat::zeros(50,50,CV_8UC1);
+    cv::Mat roi  = page(cv::Rect(10,5,20,40));
+    drawer.DrawInto(roi);
+    EXPECT_EQ(cv::norm(roi,expected_mat,cv::NORM_L1),0);
+}
+
+TEST(ElementDrawer,TestGetOutputSize) {
+    EXPECT_THROW(improc::ElementDrawer().GetOutputSize(),improc::processing_flow_error);
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/element_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestDrawer>});
+    improc::ElementDrawer drawer = improc::ElementDrawer(factory,json_content);
+    EXPECT_EQ(drawer.GetOutputSize(),cv::Size(20,40));
+    EXPECT_EQ(drawer.GetOutputSize(),drawer.Draw().size());
+}
+
+TEST(ElementDrawer,TestVerifyWithScaleFactor) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/element_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPatternDrawer>});
+    improc::ElementDrawer drawer = improc::ElementDrawer(factory,json_content);
+    cv::Size native_size = drawer.GetNativeSize();
+    EXPECT_EQ(native_size,cv::Size(10,20));
+    EXPECT_EQ(drawer.GetScaleFactor(native_size),2);
+
+    cv::Mat page_image (60,50,CV_8UC1,cv::Scalar(255));
+    cv::Mat roi = page_image(cv::Rect(5,10,20,40));
+    drawer.DrawInto(roi);
+    EXPECT_TRUE(drawer.Verify(roi,2));
+    EXPECT_FALSE(drawer.Verify(roi,3));
+    EXPECT_FALSE(drawer.Verify(page_image(cv::Rect(4,10,20,40)),2));
+    EXPECT_THROW(drawer.Verify(roi,0),improc::value_error);
+}
+
+TEST(ElementDrawer,TestExactVerification) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/element_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestUndecodableDrawer>});
+    EXPECT_FALSE(improc::ElementDrawer(factory,json_content).get_exact_tolerance().has_value());
+    json_content["exact-verification"]["tolerance"] = -1;
+    EXPECT_THROW(improc::ElementDrawer(factory,json_content),improc::value_error);
+    json_content["exact-verification"]["tolerance"] = 3;
+    improc::ElementDrawer drawer = improc::ElementDrawer(factory,json_content);
+    EXPECT_EQ(drawer.get_exact_tolerance(),3);
+
+    cv::Mat page_image (60,50,CV_8UC1,cv::Scalar(255));
+    cv::Mat roi = page_image(cv::Rect(5,10,20,40));
+    drawer.DrawInto(roi,std::string("aa"));
+    EXPECT_TRUE(drawer.Verify(roi,2,std::string("aa")));
+    EXPECT_FALSE(drawer.Verify(roi,2,std::string("a")));
+    roi(cv::Rect(0,0,3,1)).setTo(cv::Scalar(0));
+    EXPECT_TRUE(drawer.Verify(roi,2,std::string("aa")));
+    roi.at<uint8_t>(5,5) = 0;
+    EXPECT_FALSE(drawer.Verify(roi,2,std::string("aa")));
+
+    json_content["render-cache"]["max-bytes"] = 4096;
+    improc::ElementDrawer cached_drawer = improc::ElementDrawer(factory,json_content);
+    cv::Mat element_image = cached_drawer.Draw(std::string("aa"));
+    EXPECT_TRUE(cached_drawer.Verify(element_image,2,std::string("aa")));
+    EXPECT_EQ(cached_drawer.get_render_cache()->get_hits(),0);
+    EXPECT_EQ(cached_drawer.get_render_cache()->get_misses(),1);
+}
+
+TEST(ElementDrawer,TestExactVerificationDrawsOnce) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/element_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    json_content["exact-verification"]["tolerance"] = 0;
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestCountingDrawer>});
+    improc::ElementDrawer drawer = improc::ElementDrawer(factory,json_content);
+    cv::Mat element_image = drawer.Draw(std::string("aa"));
+
+    TestCountingDrawer::number_draws = 0;
+    EXPECT_TRUE(drawer.Verify(element_image,2,std::string("aa")));
+    EXPECT_EQ(TestCountingDrawer::number_draws,1);
+    EXPECT_FALSE(drawer.Verify(element_image,1,std::string("aa")));
+    EXPECT_FALSE(drawer.Verify(element_image(cv::Rect(0,0,20,20)),2,std::string("aa")));
+}
@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+
+#include <improc_drawer_test_config.hpp>
+
+#include <improc/drawer/drawer_types/fiducial_drawer.hpp>
+
+TEST(FiducialDrawer,TestConstructor) {
+    EXPECT_NO_THROW(improc::FiducialDrawer());
+    EXPECT_NO_THROW(improc::FiducialDrawer(Json::Value()));
+}
+
+TEST(FiducialDrawer,TestDraw) {
+    improc::FiducialDrawer drawer {};
+    cv::Mat fiducial = drawer.Draw();
+    EXPECT_EQ(fiducial.size(),cv::Size(improc::FiducialDrawer::kNumberModules,improc::FiducialDrawer::kNumberModules));
+    EXPECT_EQ(drawer.GetOutputSize(),fiducial.size());
+    EXPECT_EQ(fiducial.at<uint8_t>(0,0),improc::BaseDrawer::kBlackValue);
+    EXPECT_EQ(fiducial.at<uint8_t>(1,1),improc::BaseDrawer::kWhiteValue);
+    EXPECT_EQ(fiducial.at<uint8_t>(1,3),improc::BaseDrawer::kWhiteValue);
+    EXPECT_EQ(fiducial.at<uint8_t>(2,2),improc::BaseDrawer::kBlackValue);
+    EXPECT_EQ(fiducial.at<uint8_t>(3,3),improc::BaseDrawer::kBlackValue);
+    EXPECT_EQ(fiducial.at<uint8_t>(6,6),improc::BaseDrawer::kBlackValue);
+
+    cv::Mat page_image (20,20,CV_8UC1,cv::Scalar(improc::BaseDrawer::kWhiteValue));
+    cv::Mat roi = page_image(cv::Rect(5,5,fiducial.cols,fiducial.rows));
+    drawer.DrawInto(roi);
+    EXPECT_EQ(cv::norm(roi,fiducial,cv::NORM_L1),0);
+}
+
+TEST(FiducialDrawer,TestVerify) {
+    improc::FiducialDrawer drawer {};
+    cv::Mat fiducial = drawer.Draw();
+    EXPECT_TRUE(drawer.Verify(fiducial));
+    fiducial.at<uint8_t>(1,1) = improc::BaseDrawer::kBlackValue;
+    fiducial.at<uint8_t>(3,3) = improc::BaseDrawer::kWhiteValue;
+    EXPECT_TRUE(drawer.Verify(fiducial));
+    fiducial.at<uint8_t>(0,0) = improc::BaseDrawer::kWhiteValue;
+    EXPECT_FALSE(drawer.Verify(fiducial));
+    EXPECT_FALSE(drawer.Verify(cv::Mat(5,5,CV_8UC1,cv::Scalar(improc::BaseDrawer::kBlackValue))));
+}
@@ -112,7 +112,7 @@ TEST(GridDrawer,TestDrawWithoutAllocation) {
     factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestGridDrawer>});
     improc::GridDrawer drawer = improc::GridDrawer(factory,json_content);
     std::list<std::optional<improc::DrawerVariant>> context {};
-    for (size_t idx = 0; idx < drawer.get_page_elements().size()/3; idx++)
+    for (size_t idx = 0; idx < drawer.get_number_elements()/3; idx++)
     {
         context.emplace_back();
         context.emplace_back("example");
@@ -130,7 +130,7 @@ TEST(GridDrawer,TestDrawWithAllocation) {
     factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestGridDrawer>});
     improc::GridDrawer drawer = improc::GridDrawer(factory,json_content);
     std::list<std::optional<improc::DrawerVariant>> context {};
-    for (size_t idx = 0; idx < drawer.get_page_elements().size()/3; idx++)
+    for (size_t idx = 0; idx < drawer.get_number_elements()/3; idx++)
     {
         context.emplace_back();
         context.emplace_back("example");
@@ -141,3 +141,54 @@ TEST(GridDrawer,TestDrawWithAllocation) {
     EXPECT_THROW(drawer.Verify(cv::Mat(),context),improc::value_error);
     EXPECT_TRUE(drawer.Verify(drawer.Allocate().Draw(context),context));
 }
+
+TEST(GridDrawer,TestAllocateFromCellTemplate) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/grid_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestGridDrawer>});
+    improc::GridDrawer drawer = improc::GridDrawer(factory,json_content);
+    std::list<std::optional<improc::DrawerVariant>> context {};
+    for (size_t idx = 0; idx < drawer.get_number_elements()/3; idx++)
+    {
+        context.emplace_back();
+        context.emplace_back("example");
+        context.emplace_back();
+    }
+    cv::Mat page_image = drawer.Allocate().Draw(context);
+    const std::vector<improc::PageElementDrawer>& page_elements = drawer.get_page_elements();
+    std::vector<cv::Rect> cell_boxes {};
+    std::for_each(page_elements.begin(),std::next(page_elements.begin(),3),[&cell_boxes] (const improc::PageElementDrawer& elem) {cell_boxes.push_back(elem.get_element_box());});
+    EXPECT_EQ(page_elements.size(),24);
+    EXPECT_EQ(cell_boxes[0],cv::Rect(10,5,50,100));
+    EXPECT_EQ(cell_boxes[1],cv::Rect(200,5,100,50));
+    EXPECT_EQ(cell_boxes[2],cv::Rect(10,200,50,100));
+
+    cv::Mat first_cell = page_image(cv::Rect(0,0,500,400));
+    size_t  elem_idx   = 0;
+    for (const improc::PageElementDrawer& elem : page_elements)
+    {
+        cv::Point cell_offset {static_cast<int>(elem_idx / 12) * 520, static_cast<int>((elem_idx / 3) % 4) * 410};
+        EXPECT_EQ(elem.get_element_box(),cell_boxes[elem_idx % 3] + cell_offset);
+        EXPECT_EQ(cv::countNonZero(page_image(cv::Rect(cell_offset,cv::Size(500,400))) != first_cell),0);
+        elem_idx++;
+    }
+}
+
+TEST(GridDrawer,TestElementSlots) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/grid_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    json_content["cell-content"]["elements"][0]["id"] = "serial";
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestGridDrawer>});
+    improc::GridDrawer drawer = improc::GridDrawer(factory,json_content);
+    EXPECT_TRUE(drawer.get_page_elements().empty());
+    EXPECT_EQ(drawer.get_number_elements(),24);
+    EXPECT_EQ(drawer.get_element_slots().size(),8);
+    EXPECT_EQ(drawer.GetElementSlot("serial[0,0]"),0);
+    EXPECT_EQ(drawer.GetElementSlot("serial[1,2]"),18);
+    EXPECT_THROW(drawer.GetElementSlot("serial"),improc::value_error);
+    drawer.Allocate();
+    EXPECT_EQ(drawer.get_element_slots().size(),8);
+    EXPECT_EQ(drawer.get_page_elements()[drawer.GetElementSlot("serial[1,3]")].get_element_id(),"serial[1,3]");
+}
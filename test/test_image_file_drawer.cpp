@@ -62,3 +62,25 @@ TEST(ImageFileDrawer,TestDraw) {
     EXPECT_FALSE(drawer.Verify(false_mat1));
     EXPECT_FALSE(drawer.Verify(false_mat2));
 }
+
+TEST(ImageFileDrawer,TestDrawInto) {
+    improc::ApplicationContext::get()->set_application_folder(std::string(IMPROC_DRAWER_TEST_FOLDER));
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/image_file_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::ImageFileDrawer drawer {};
+    drawer.Load(json_content);
+    cv::Mat page = cv::Mat::zeros(327,392,CV_8UC1);
+    cv::Mat roi  = page(cv::Rect(5,5,382,317));
+    drawer.DrawInto(roi);
+    EXPECT_TRUE(drawer.Verify(roi));
+    cv::Mat invalid_roi = page(cv::Rect(0,0,300,300));
+    EXPECT_THROW(drawer.DrawInto(invalid_roi),improc::value_error);
+}
+
+TEST(ImageFileDrawer,TestGetOutputSize) {
+    improc::ApplicationContext::get()->set_application_folder(std::string(IMPROC_DRAWER_TEST_FOLDER));
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/image_file_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::ImageFileDrawer drawer {json_content};
+    EXPECT_EQ(drawer.GetOutputSize(),cv::Size(382,317));
+}
@@ -129,3 +129,50 @@ TEST(LayoutDrawer,TestDrawWithAllocation) {
     EXPECT_THROW(drawer.Verify(cv::Mat(),context),improc::value_error);
     EXPECT_TRUE(drawer.Verify(drawer.Allocate().Draw(context),context));
 }
+
+TEST(LayoutDrawer,TestDrawBatch) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/layout_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestLayoutDrawer>});
+    improc::LayoutDrawer drawer = improc::LayoutDrawer(factory,json_content);
+    std::list<std::optional<improc::DrawerVariant>> context {};
+    for (size_t idx = 0; idx < 8; idx++)
+    {
+        context.emplace_back("example");
+        context.emplace_back();
+        context.emplace_back();
+    }
+    context.emplace_back();
+    context.emplace_back("example");
+    context.emplace_back();
+    std::vector<std::list<std::optional<improc::DrawerVariant>>> contexts (8,context);
+    std::vector<cv::Mat> pages = drawer.Allocate().DrawBatch(contexts);
+    EXPECT_EQ(pages.size(),contexts.size());
+    for (const cv::Mat& page : pages)
+    {
+        EXPECT_EQ(page.size(),drawer.get_page_size());
+        EXPECT_TRUE(drawer.Verify(page,context));
+    }
+}
+
+TEST(LayoutDrawer,TestAllocateGridFromCellTemplate) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/layout_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestLayoutDrawer>});
+    improc::LayoutDrawer drawer      = improc::LayoutDrawer(factory,json_content);
+    improc::GridDrawer   grid_drawer = improc::GridDrawer(factory,json_content[0]);
+    EXPECT_EQ(drawer.get_render_plan(),nullptr);
+    std::shared_ptr<const improc::RenderPlan> render_plan      = drawer.Allocate().get_render_plan();
+    std::shared_ptr<const improc::RenderPlan> grid_render_plan = grid_drawer.Allocate().get_render_plan();
+    cv::Point grid_top_left {10,20};
+    EXPECT_EQ(render_plan->get_number_elements(),27);
+    for (size_t elem_idx = 0; elem_idx < grid_render_plan->get_number_elements(); elem_idx++)
+    {
+        EXPECT_EQ(render_plan->get_element_boxes()[elem_idx],grid_render_plan->get_element_boxes()[elem_idx] + grid_top_left);
+    }
+    cv::Mat grid_page_image = render_plan->get_background()(cv::Rect(grid_top_left,grid_drawer.get_page_size()));
+    EXPECT_EQ(cv::countNonZero(grid_page_image != grid_render_plan->get_background()),0);
+    EXPECT_EQ(drawer.Allocate().get_render_plan()->get_element_boxes(),render_plan->get_element_boxes());
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <improc/drawer/engine/page_buffer_pool.hpp>
+
+#include <vector>
+
+TEST(PooledPage,TestConstructor) {
+    improc::PooledPage page {};
+    EXPECT_TRUE(page.get_page_image().empty());
+    EXPECT_NO_THROW(page.Release());
+}
+
+TEST(PageBufferPool,TestAcquire) {
+    improc::PageBufferPool pool {};
+    improc::PooledPage page = pool.Acquire(cv::Size(40,30),CV_8UC1);
+    EXPECT_EQ(page.get_page_image().cols,40);
+    EXPECT_EQ(page.get_page_image().rows,30);
+    EXPECT_EQ(page.get_page_image().type(),CV_8UC1);
+    EXPECT_EQ(pool.get_number_idle_buffers(),0);
+}
+
+TEST(PageBufferPool,TestReuseReleasedPage) {
+    improc::PageBufferPool pool {};
+    uchar* page_data = nullptr;
+    {
+        improc::PooledPage page = pool.Acquire(cv::Size(40,30),CV_8UC1);
+        page_data = page.get_page_image().data;
+    }
+    EXPECT_EQ(pool.get_number_idle_buffers(),1);
+    improc::PooledPage page = pool.Acquire(cv::Size(40,30),CV_8UC1);
+    EXPECT_EQ(page.get_page_image().data,page_data);
+    EXPECT_EQ(pool.get_number_idle_buffers(),0);
+}
+
+TEST(PageBufferPool,TestDifferentSize) {
+    improc::PageBufferPool pool {};
+    pool.Acquire(cv::Size(40,30),CV_8UC1).Release();
+    improc::PooledPage page = pool.Acquire(cv::Size(30,40),CV_8UC1);
+    EXPECT_EQ(page.get_page_image().cols,30);
+    EXPECT_EQ(page.get_page_image().rows,40);
+    EXPECT_EQ(pool.get_number_idle_buffers(),1);
+}
+
+TEST(PageBufferPool,TestAliasedPageNotReused) {
+    improc::PageBufferPool pool {};
+    improc::PooledPage page = pool.Acquire(cv::Size(40,30),CV_8UC1);
+    cv::Mat alias = page.get_page_image();
+    page.Release();
+    EXPECT_EQ(pool.get_number_idle_buffers(),0);
+    EXPECT_FALSE(alias.empty());
+}
+
+TEST(PageBufferPool,TestMaxIdleBuffers) {
+    improc::PageBufferPool pool {1};
+    improc::PooledPage page_a = pool.Acquire(cv::Size(40,30),CV_8UC1);
+    improc::PooledPage page_b = pool.Acquire(cv::Size(40,30),CV_8UC1);
+    page_a.Release();
+    page_b.Release();
+    EXPECT_EQ(pool.get_number_idle_buffers(),1);
+}
+
+TEST(PageBufferPool,TestDefaultMaxIdleBuffers) {
+    improc::PageBufferPool pool {};
+    std::vector<improc::PooledPage> pages {};
+    for (size_t page_idx = 0; page_idx < improc::PageBufferPool::kDefaultMaxIdleBuffers + 4; page_idx++)
+    {
+        pages.push_back(pool.Acquire(cv::Size(40,30),CV_8UC1));
+    }
+    pages.clear();
+    EXPECT_EQ(pool.get_number_idle_buffers(),improc::PageBufferPool::kDefaultMaxIdleBuffers);
+}
+
+TEST(PageBufferPool,TestPageOutlivesPool) {
+    improc::PooledPage page {};
+    {
+        improc::PageBufferPool pool {};
+        page = pool.Acquire(cv::Size(40,30),CV_8UC1);
+    }
+    EXPECT_FALSE(page.get_page_image().empty());
+    EXPECT_NO_THROW(page.Release());
+}
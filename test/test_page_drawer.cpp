@@ -5,6 +5,8 @@
 #include <improc/drawer/engine/page_drawer.hpp>
 #include <improc/infrastructure/filesystem/file.hpp>
 
+#include <thread>
+
 TEST(PageDrawer,TestConstructor) {
     EXPECT_NO_THROW(improc::PageDrawer());
 }
@@ -15,6 +17,16 @@ TEST(PageDrawer,TestEmptyDraw) {
     EXPECT_TRUE(drawer.Verify());
 }
 
+TEST(PageDrawer,TestVerifyEmptyPageImage) {
+    improc::PageDrawer drawer {};
+    improc::WorkerPool worker_pool {2};
+    std::list<std::optional<improc::DrawerVariant>> context {};
+    cv::Mat page_image (10,10,improc::BaseDrawer::kImageDataType,improc::BaseDrawer::kWhiteValue);
+    EXPECT_TRUE(drawer.Verify(cv::Mat(),context));
+    EXPECT_THROW(drawer.Verify(page_image,context),improc::value_error);
+    EXPECT_THROW(drawer.Verify(page_image,context,worker_pool),improc::value_error);
+}
+
 TEST(PageDrawer,TestConstructorWithLoad) {
     std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_config.json";
     Json::Value json_content  = improc::JsonFile::Read(json_filepath);
@@ -160,3 +172,309 @@ TEST(PageDrawer,TestOverlayedDraw) {
     EXPECT_NO_THROW(drawer.Allocate().Draw(context));
     EXPECT_TRUE(drawer.Verify(context));
 }
+
+TEST(PageDrawer,TestDrawBatch) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::list<std::optional<improc::DrawerVariant>> context {};
+    context.push_back("test_a");
+    context.emplace_back();
+    context.emplace_back();
+    std::vector<std::list<std::optional<improc::DrawerVariant>>> contexts (16,context);
+    improc::WorkerPool worker_pool {4};
+    std::vector<cv::Mat> pages = drawer.Allocate().DrawBatch(contexts,worker_pool);
+    EXPECT_EQ(pages.size(),contexts.size());
+    cv::Mat expected_page = drawer.Draw(context).clone();
+    for (const cv::Mat& page : pages)
+    {
+        EXPECT_EQ(cv::norm(page,expected_page,cv::NORM_L1),0);
+        EXPECT_NE(page.data,expected_page.data);
+    }
+}
+
+TEST(PageDrawer,TestDrawBatchInvalidContext) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::vector<std::list<std::optional<improc::DrawerVariant>>> contexts (4);
+    EXPECT_THROW(drawer.Allocate().DrawBatch(contexts),improc::value_error);
+}
+
+TEST(PageDrawer,TestDrawLevels) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem_overlayed.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    EXPECT_TRUE(drawer.get_draw_levels().empty());
+    std::vector<std::vector<size_t>> draw_levels = drawer.Allocate().get_draw_levels();
+    EXPECT_EQ(draw_levels.size(),2);
+    EXPECT_EQ(draw_levels[0],std::vector<size_t>({0}));
+    EXPECT_EQ(draw_levels[1],std::vector<size_t>({2}));
+}
+
+TEST(PageDrawer,TestDrawWithWorkerPool) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem_overlayed.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::list<std::optional<improc::DrawerVariant>> context {};
+    context.push_back("test_a");
+    context.emplace_back();
+    context.emplace_back();
+    improc::WorkerPool worker_pool {4};
+    cv::Mat expected_page = drawer.Allocate().Draw(context).clone();
+    cv::Mat page = drawer.Allocate().Draw(context,worker_pool);
+    EXPECT_EQ(cv::norm(page,expected_page,cv::NORM_L1),0);
+    EXPECT_TRUE(drawer.Verify(context));
+}
+
+TEST(PageDrawer,TestDrawWithWorkerPoolWithoutAllocate) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::list<std::optional<improc::DrawerVariant>> context (3);
+    improc::WorkerPool worker_pool {2};
+    EXPECT_THROW(drawer.Draw(context,worker_pool),improc::processing_flow_error);
+}
+
+TEST(PageDrawer,TestVerifyWithWorkerPool) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_element_ids.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_message_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestMessageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::list<std::optional<improc::DrawerVariant>> context {std::string("aa"),std::string("bb"),std::string("cc"),std::nullopt};
+    improc::WorkerPool worker_pool {4};
+    EXPECT_THROW(drawer.Verify(context,worker_pool),improc::processing_flow_error);
+
+    cv::Mat page_image = drawer.Allocate().Draw(context).clone();
+    improc::VerificationReport report = drawer.Verify(context,worker_pool);
+    EXPECT_TRUE(report.IsValid());
+    EXPECT_EQ(report.get_element_results().size(),4);
+    EXPECT_EQ(report.GetNumberVerified(),4);
+    EXPECT_TRUE(report.GetInvalidElements().empty());
+
+    *std::next(context.begin()) = std::string("bbb");
+    report = drawer.Verify(page_image,context,worker_pool);
+    EXPECT_FALSE(report.IsValid());
+    EXPECT_EQ(report.GetNumberVerified(),4);
+    EXPECT_EQ(report.GetInvalidElements(),std::vector<size_t>({1}));
+    EXPECT_FALSE(report.get_element_results()[1].is_valid);
+    EXPECT_FALSE(drawer.Verify(page_image,context));
+
+    // A single worker verifies page elements in page order, so page elements after the failure are skipped.
+    improc::WorkerPool single_worker_pool {1};
+    report = drawer.Verify(page_image,context,single_worker_pool,improc::VerificationPolicy::kFailFast);
+    EXPECT_FALSE(report.IsValid());
+    EXPECT_EQ(report.GetNumberVerified(),2);
+    EXPECT_FALSE(report.get_element_results()[2].is_verified);
+    EXPECT_EQ(report.get_element_results()[3].duration.count(),0);
+    EXPECT_THROW(drawer.Verify(cv::Mat(),context,worker_pool),improc::value_error);
+}
+
+TEST(PageDrawer,TestVerifyExternalPageImage) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_element_ids.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_message_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestMessageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::list<std::optional<improc::DrawerVariant>> context {std::string("aa"),std::string("bb"),std::string("cc"),std::nullopt};
+    std::list<std::optional<improc::DrawerVariant>> scan_context {std::string("a"),std::string("b"),std::string("c"),std::nullopt};
+    cv::Mat scanned_page {};
+    drawer.Allocate().Draw(scanned_page,scan_context);
+    cv::Mat expected_scanned_page = scanned_page.clone();
+    cv::Mat drawn_page = drawer.Draw(context).clone();
+
+    const improc::PageDrawer& const_drawer = drawer;
+    EXPECT_TRUE(const_drawer.Verify(scanned_page,scan_context));
+    EXPECT_TRUE(drawer.Verify(context));
+    drawer.Draw(context);
+    EXPECT_EQ(cv::norm(scanned_page,expected_scanned_page,cv::NORM_L1),0);
+
+    std::thread verify_thread { [&const_drawer,&scanned_page,&scan_context] ()
+                                {
+                                    for (int verify_idx = 0; verify_idx < 20; verify_idx++)
+                                    {
+                                        EXPECT_TRUE(const_drawer.Verify(scanned_page,scan_context));
+                                    }
+                                }
+                              };
+    for (int draw_idx = 0; draw_idx < 20; draw_idx++)
+    {
+        EXPECT_EQ(cv::norm(drawer.Draw(context),drawn_page,cv::NORM_L1),0);
+    }
+    verify_thread.join();
+}
+
+TEST(PageDrawer,TestDrawInPageImage) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::list<std::optional<improc::DrawerVariant>> context {};
+    context.push_back("test_a");
+    context.emplace_back();
+    context.emplace_back();
+    cv::Mat page_image {};
+    EXPECT_THROW(drawer.Draw(page_image,context),improc::processing_flow_error);
+    cv::Mat expected_page = drawer.Allocate().Draw(context);
+    drawer.Draw(page_image,context);
+    EXPECT_EQ(cv::norm(page_image,expected_page,cv::NORM_L1),0);
+    EXPECT_NE(page_image.data,expected_page.data);
+    uchar* page_data = page_image.data;
+    drawer.Draw(page_image,context);
+    EXPECT_EQ(page_image.data,page_data);
+}
+
+TEST(PageDrawer,TestDrawInPooledPage) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::list<std::optional<improc::DrawerVariant>> context {};
+    context.push_back("test_a");
+    context.emplace_back();
+    context.emplace_back();
+    improc::PageBufferPool pool {};
+    cv::Mat expected_page = drawer.Allocate().Draw(context);
+    uchar* page_data = nullptr;
+    {
+        improc::PooledPage page = drawer.Draw(pool,context);
+        EXPECT_EQ(cv::norm(page.get_page_image(),expected_page,cv::NORM_L1),0);
+        EXPECT_NE(page.get_page_image().data,expected_page.data);
+        page_data = page.get_page_image().data;
+    }
+    improc::PooledPage page = drawer.Draw(pool,context);
+    EXPECT_EQ(page.get_page_image().data,page_data);
+}
+
+TEST(PageDrawer,TestExtractPageElements) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    drawer.Allocate();
+    std::vector<improc::PageElementDrawer> page_elements = drawer.ExtractPageElements();
+    EXPECT_EQ(page_elements.size(),3);
+    EXPECT_TRUE(drawer.get_page_elements().empty());
+    EXPECT_TRUE(drawer.get_draw_levels().empty());
+    cv::Mat page_image {};
+    EXPECT_THROW(drawer.Draw(page_image,std::list<std::optional<improc::DrawerVariant>>()),improc::processing_flow_error);
+}
+
+TEST(PageDrawer,TestElementSlots) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_element_ids.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_message_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestMessageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    EXPECT_EQ(drawer.get_element_slots().size(),3);
+    EXPECT_EQ(drawer.GetElementSlot("serial") ,0);
+    EXPECT_EQ(drawer.GetElementSlot("batch")  ,1);
+    EXPECT_EQ(drawer.GetElementSlot("overlay"),2);
+    EXPECT_THROW(drawer.GetElementSlot("static"),improc::value_error);
+
+    json_content["elements"][1]["id"] = "serial";
+    EXPECT_THROW(improc::PageDrawer(factory,json_content),improc::value_error);
+}
+
+TEST(PageDrawer,TestDrawSlots) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_element_ids.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_message_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestMessageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    EXPECT_THROW(drawer.DrawSlots({{"serial",std::string("a")}}),improc::processing_flow_error);
+
+    std::list<std::optional<improc::DrawerVariant>> context {std::string("aa"),std::string("bbb"),std::string("c"),std::nullopt};
+    drawer.Allocate().Draw(context);
+    EXPECT_THROW(drawer.DrawSlots({{"serial",std::string("a")}}),improc::processing_flow_error);
+    drawer.set_incremental_draw(true).Draw(context);
+    context.front() = std::string("aaaa");
+    cv::Mat expected_page {};
+    drawer.Draw(expected_page,context);
+
+    cv::Mat page_image = drawer.DrawSlots({{"serial",std::string("aaaa")}});
+    EXPECT_EQ(cv::norm(page_image,expected_page,cv::NORM_L1),0);
+    EXPECT_TRUE(drawer.Verify(context));
+
+    context.back() = std::nullopt;
+    *std::next(context.begin()) = std::string("b");
+    drawer.Draw(expected_page,context);
+    page_image = drawer.DrawSlots(std::vector<std::pair<size_t,std::optional<improc::DrawerVariant>>> {{drawer.GetElementSlot("batch"),std::string("b")}});
+    EXPECT_EQ(cv::norm(page_image,expected_page,cv::NORM_L1),0);
+    EXPECT_THROW(drawer.DrawSlots(std::vector<std::pair<size_t,std::optional<improc::DrawerVariant>>> {{3,std::string("a")}}),improc::value_error);
+    EXPECT_THROW(drawer.DrawSlots(std::vector<std::pair<size_t,std::optional<improc::DrawerVariant>>> {{4,std::string("a")}}),improc::value_error);
+    EXPECT_THROW(drawer.DrawSlots({{"unknown",std::string("a")}}),improc::value_error);
+    drawer.Draw(context,improc::WorkerPool::GetDefault());
+    EXPECT_THROW(drawer.DrawSlots({{"serial",std::string("a")}}),improc::processing_flow_error);
+
+    json_content["elements"][2]["top-left"]["x"] = 15;
+    json_content["elements"][2]["top-left"]["y"] = 12;
+    improc::PageDrawer overlay_drawer = improc::PageDrawer(factory,json_content);
+    context = {std::string("aa"),std::string("bbb"),std::string("c"),std::nullopt};
+    overlay_drawer.Allocate().set_incremental_draw(true).Draw(context);
+    context.front() = std::string("aaaa");
+    overlay_drawer.Draw(expected_page,context);
+    page_image = overlay_drawer.DrawSlots({{"serial",std::string("aaaa")}});
+    EXPECT_EQ(cv::norm(page_image,expected_page,cv::NORM_L1),0);
+
+    EXPECT_ANY_THROW(overlay_drawer.DrawSlots({{"serial",std::vector<std::byte>({std::byte{1}})}}));
+    EXPECT_THROW(overlay_drawer.DrawSlots({{"serial",std::string("aaaa")}}),improc::processing_flow_error);
+    overlay_drawer.ResetSkipCounters();
+    page_image = overlay_drawer.Draw(context);
+    EXPECT_EQ(cv::norm(page_image,expected_page,cv::NORM_L1),0);
+    EXPECT_EQ(overlay_drawer.get_skip_counters(),std::vector<size_t>({0,0,0,0}));
+}
+
+TEST(PageDrawer,TestIncrementalDraw) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_element_ids.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_message_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestMessageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    EXPECT_FALSE(drawer.is_incremental_draw());
+    drawer.Allocate().set_incremental_draw(true);
+    EXPECT_TRUE(drawer.is_incremental_draw());
+
+    std::list<std::optional<improc::DrawerVariant>> context {std::string("aa"),std::string("bbb"),std::string("c"),std::nullopt};
+    cv::Mat expected_page {};
+    drawer.Draw(expected_page,context);
+    EXPECT_EQ(cv::norm(drawer.Draw(context),expected_page,cv::NORM_L1),0);
+    EXPECT_EQ(drawer.get_skip_counters(),std::vector<size_t>({0,0,0,0}));
+    EXPECT_EQ(cv::norm(drawer.Draw(context),expected_page,cv::NORM_L1),0);
+    EXPECT_EQ(drawer.get_skip_counters(),std::vector<size_t>({1,1,1,0}));
+
+    *std::next(context.begin()) = std::string("b");
+    drawer.Draw(expected_page,context);
+    EXPECT_EQ(cv::norm(drawer.Draw(context),expected_page,cv::NORM_L1),0);
+    EXPECT_EQ(drawer.get_skip_counters(),std::vector<size_t>({2,1,2,0}));
+
+    context.front() = std::string("aaaa");
+    drawer.Draw(expected_page,context);
+    EXPECT_EQ(cv::norm(drawer.Draw(context),expected_page,cv::NORM_L1),0);
+    EXPECT_TRUE(drawer.Verify(context));
+
+    drawer.ResetSkipCounters().set_incremental_draw(false);
+    drawer.Draw(context);
+    EXPECT_EQ(drawer.get_skip_counters(),std::vector<size_t>({0,0,0,0}));
+}
+
+TEST(PageDrawer,TestHashMessage) {
+    EXPECT_EQ(improc::BaseDrawer::HashMessage(std::string("abc")),improc::BaseDrawer::HashMessage(std::string("abc")));
+    EXPECT_NE(improc::BaseDrawer::HashMessage(std::string("abc")),improc::BaseDrawer::HashMessage(std::string("abd")));
+    EXPECT_NE(improc::BaseDrawer::HashMessage(std::string()),improc::BaseDrawer::HashMessage(std::nullopt));
+    EXPECT_NE(improc::BaseDrawer::HashMessage(std::string()),improc::BaseDrawer::HashMessage(std::vector<std::byte>()));
+}
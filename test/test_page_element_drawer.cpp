@@ -169,3 +169,45 @@ TEST(PageElementDrawer,TestIncrementTopLeft) {
     EXPECT_EQ(page_2.at<uint8_t>(cv::Point(15,10)),255);
     EXPECT_TRUE(drawer.Verify(page_2));
 }
+
+TEST(PageElementDrawer,TestAllocateWithElementBox) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_element_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    json_content["drawer-size"]["width"]  = 100;
+    json_content["drawer-size"]["height"] = 200;
+    cv::Mat page = cv::Mat::zeros(300,300,CV_8UC1);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageElemDrawer>});
+    improc::PageElementDrawer drawer = improc::PageElementDrawer(factory,json_content,page.size());
+    drawer.Allocate();
+    cv::Rect element_box = drawer.get_element_box();
+    EXPECT_EQ(drawer.get_element_scale(),2);
+    EXPECT_EQ(element_box.size(),cv::Size(100,200));
+
+    improc::PageElementDrawer cached_drawer = improc::PageElementDrawer(factory,json_content,page.size());
+    EXPECT_THROW(cached_drawer.Allocate(element_box,3),improc::value_error);
+    EXPECT_THROW(cached_drawer.Allocate(element_box,0),improc::value_error);
+    cached_drawer.Allocate(element_box,2).Draw(page);
+    EXPECT_EQ(cached_drawer.get_element_scale(),2);
+    EXPECT_TRUE(cached_drawer.Verify(page));
+}
+
+TEST(PageElementDrawer,TestVerifyDynamicElementScale) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_element_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    json_content["drawer-size"]["width"]  = 20;
+    json_content["drawer-size"]["height"] = 20;
+    cv::Mat page = cv::Mat::zeros(200,100,CV_8UC1);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestSizedMessageDrawer>});
+    improc::PageElementDrawer drawer = improc::PageElementDrawer(factory,json_content,page.size());
+    drawer.Allocate();
+    EXPECT_EQ(drawer.get_element_scale(),4);
+    EXPECT_EQ(drawer.get_element_box().size(),cv::Size(20,20));
+
+    std::string message (10,'a');
+    drawer.Draw(page,message);
+    EXPECT_EQ(cv::countNonZero(page),20*20);
+    EXPECT_TRUE (drawer.Verify(page,message));
+    EXPECT_FALSE(drawer.Verify(page,std::string(9,'a')));
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <improc_drawer_test_config.hpp>
+
+#include <improc/drawer/page_registration.hpp>
+#include <improc/drawer/engine/page_drawer.hpp>
+#include <improc/drawer/drawer_types/fiducial_drawer.hpp>
+#include <improc/drawer/drawer_types/qrcode_drawer.hpp>
+#include <improc/infrastructure/filesystem/file.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+namespace
+{
+    improc::DrawerFactory CreateRegistrationFactory()
+    {
+        improc::DrawerFactory factory {};
+        factory.Register("fiducial",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<improc::FiducialDrawer>});
+        factory.Register("fiducial_check",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<improc::FiducialDrawer>});
+        factory.Register("qrcode",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<improc::QrCodeDrawer>});
+        return factory;
+    }
+}
+
+TEST(PageRegistration,TestConstructor) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_registration_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory = CreateRegistrationFactory();
+    improc::PageDrawer drawer {factory,json_content};
+    EXPECT_THROW(improc::PageRegistration(drawer.get_render_plan(),"fiducial",10),improc::processing_flow_error);
+
+    drawer.Allocate();
+    improc::PageRegistration registration {drawer.get_render_plan(),"fiducial",10};
+    EXPECT_EQ(registration.get_fiducial_elements(),std::vector<size_t>({0,1,2,3}));
+    EXPECT_EQ(registration.get_search_margin(),10);
+    EXPECT_THROW(improc::PageRegistration(drawer.get_render_plan(),"fiducial_check",10),improc::value_error);
+
+    json_content["elements"][0]["static"] = false;
+    improc::PageDrawer dynamic_drawer {factory,json_content};
+    dynamic_drawer.Allocate();
+    EXPECT_THROW(improc::PageRegistration(dynamic_drawer.get_render_plan(),"fiducial",10),improc::value_error);
+}
+
+TEST(PageRegistration,TestVerifyScan) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_registration_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::PageDrawer drawer {CreateRegistrationFactory(),json_content};
+    std::list<std::optional<improc::DrawerVariant>> context (6,std::nullopt);
+    cv::Mat page_image = drawer.Allocate().Draw(context).clone();
+
+    cv::Mat scan_transform = cv::getRotationMatrix2D(cv::Point2f(100,100),2.0,1.2);
+    scan_transform.at<double>(0,2) += 27;
+    scan_transform.at<double>(1,2) += 14;
+    cv::Mat scan_image {};
+    cv::warpAffine(page_image,scan_image,scan_transform,cv::Size(260,250),cv::INTER_LINEAR,cv::BORDER_CONSTANT,cv::Scalar(improc::BaseDrawer::kWhiteValue));
+
+    improc::PageRegistration registration {drawer.get_render_plan(),"fiducial",20};
+    cv::Matx33d homography = registration.EstimateHomography(scan_image);
+    std::vector<cv::Point2d> page_center {cv::Point2d(99.5,99.5)};
+    std::vector<cv::Point2d> scan_center {};
+    cv::perspectiveTransform(page_center,scan_center,homography);
+    EXPECT_NEAR(scan_center[0].x,scan_transform.at<double>(0,0) * 99.5 + scan_transform.at<double>(0,1) * 99.5 + scan_transform.at<double>(0,2),2.0);
+    EXPECT_NEAR(scan_center[0].y,scan_transform.at<double>(1,0) * 99.5 + scan_transform.at<double>(1,1) * 99.5 + scan_transform.at<double>(1,2),2.0);
+
+    improc::VerificationReport report = registration.Verify(scan_image,context);
+    EXPECT_TRUE(report.IsValid());
+    EXPECT_EQ(report.GetNumberVerified(),6);
+    EXPECT_TRUE(report.GetInvalidElements().empty());
+
+    cv::Mat blank_scan (250,260,CV_8UC1,cv::Scalar(improc::BaseDrawer::kWhiteValue));
+    EXPECT_FALSE(registration.Verify(blank_scan,context).IsValid());
+    EXPECT_THROW(registration.Verify(scan_image,{std::nullopt}),improc::value_error);
+    EXPECT_THROW(registration.EstimateHomography(cv::Mat()),improc::value_error);
+}
+
+TEST(PageRegistration,TestVerifyDisplacedElement) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_registration_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::PageDrawer drawer {CreateRegistrationFactory(),json_content};
+    std::list<std::optional<improc::DrawerVariant>> context (6,std::nullopt);
+    cv::Mat page_image = drawer.Allocate().Draw(context).clone();
+
+    const cv::Rect symbol_box = drawer.get_render_plan()->get_element_boxes()[5];
+    cv::Mat symbol_image = page_image(symbol_box).clone();
+    page_image(symbol_box).setTo(improc::BaseDrawer::kWhiteValue);
+    symbol_image.copyTo(page_image(symbol_box + cv::Point(5,5)));
+
+    cv::Mat scan_transform = cv::getRotationMatrix2D(cv::Point2f(100,100),2.0,1.2);
+    scan_transform.at<double>(0,2) += 27;
+    scan_transform.at<double>(1,2) += 14;
+    cv::Mat scan_image {};
+    cv::warpAffine(page_image,scan_image,scan_transform,cv::Size(260,250),cv::INTER_LINEAR,cv::BORDER_CONSTANT,cv::Scalar(improc::BaseDrawer::kWhiteValue));
+
+    improc::PageRegistration registration {drawer.get_render_plan(),"fiducial",20};
+    improc::VerificationReport report = registration.Verify(scan_image,context);
+    EXPECT_TRUE(report.IsValid());
+    EXPECT_EQ(report.GetNumberVerified(),6);
+}
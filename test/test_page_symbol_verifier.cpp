@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <improc_drawer_test_config.hpp>
+
+#include <improc/drawer/page_symbol_verifier.hpp>
+#include <improc/drawer/engine/page_drawer.hpp>
+#include <improc/drawer/drawer_types/qrcode_drawer.hpp>
+#include <improc/infrastructure/filesystem/file.hpp>
+
+TEST(PageSymbolVerifier,TestConstructorWithoutRenderPlan) {
+    EXPECT_THROW(improc::PageSymbolVerifier(nullptr,{{"qrcode",ZXing::BarcodeFormat::QRCode}}),improc::processing_flow_error);
+}
+
+TEST(PageSymbolVerifier,TestVerifyPage) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_symbol_verifier_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("qrcode",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<improc::QrCodeDrawer>});
+    improc::PageDrawer drawer {factory,json_content};
+    std::list<std::optional<improc::DrawerVariant>> context {std::string("first"),std::string("second")};
+    cv::Mat page_image = drawer.Allocate().Draw(context).clone();
+
+    improc::PageSymbolVerifier verifier {drawer.get_render_plan(),{{"qrcode",ZXing::BarcodeFormat::QRCode}}};
+    EXPECT_EQ(verifier.get_symbol_elements(),std::vector<bool>({true,true}));
+    EXPECT_EQ(verifier.get_page_pass_elements(),std::vector<bool>({true,true}));
+    improc::VerificationReport report = verifier.Verify(page_image,context);
+    EXPECT_TRUE(report.IsValid());
+    EXPECT_EQ(report.GetNumberVerified(),2);
+    EXPECT_EQ(report.IsValid(),drawer.Verify(page_image,context));
+
+    std::list<std::optional<improc::DrawerVariant>> swapped_context {std::string("second"),std::string("first")};
+    report = verifier.Verify(page_image,swapped_context);
+    EXPECT_FALSE(report.IsValid());
+    EXPECT_EQ(report.GetInvalidElements(),std::vector<size_t>({0,1}));
+
+    EXPECT_THROW(verifier.Verify(page_image,{std::string("first")}),improc::value_error);
+    EXPECT_THROW(verifier.Verify(cv::Mat(10,10,CV_8UC1),context),improc::value_error);
+}
+
+TEST(PageSymbolVerifier,TestVerifyWithoutSymbolElements) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_symbol_verifier_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("qrcode",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<improc::QrCodeDrawer>});
+    improc::PageDrawer drawer {factory,json_content};
+    std::list<std::optional<improc::DrawerVariant>> context {std::string("first"),std::string("second")};
+    cv::Mat page_image = drawer.Allocate().Draw(context).clone();
+
+    improc::PageSymbolVerifier verifier {drawer.get_render_plan(),{}};
+    EXPECT_EQ(verifier.get_symbol_elements(),std::vector<bool>({false,false}));
+    EXPECT_EQ(verifier.get_page_pass_elements(),std::vector<bool>({false,false}));
+    EXPECT_TRUE(verifier.Verify(page_image,context).IsValid());
+    EXPECT_FALSE(verifier.Verify(page_image,{std::string("second"),std::string("first")}).IsValid());
+}
+
+TEST(PageSymbolVerifier,TestVerifyAbuttingSymbols) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_symbol_verifier_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    json_content["elements"][1]["top-left"]["x"] = 114;
+    improc::DrawerFactory factory {};
+    factory.Register("qrcode",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<improc::QrCodeDrawer>});
+    improc::PageDrawer drawer {factory,json_content};
+    std::list<std::optional<improc::DrawerVariant>> context {std::string("first"),std::string("second")};
+    cv::Mat page_image = drawer.Allocate().Draw(context).clone();
+
+    improc::PageSymbolVerifier verifier {drawer.get_render_plan(),{{"qrcode",ZXing::BarcodeFormat::QRCode}}};
+    EXPECT_EQ(verifier.get_symbol_elements(),std::vector<bool>({true,true}));
+    std::vector<bool> page_pass_elements = verifier.get_page_pass_elements();
+    EXPECT_EQ(std::count(page_pass_elements.begin(),page_pass_elements.end(),false),2);
+    improc::VerificationReport report = verifier.Verify(page_image,context);
+    EXPECT_TRUE(report.IsValid());
+    EXPECT_EQ(report.GetNumberVerified(),2);
+    EXPECT_FALSE(verifier.Verify(page_image,{std::string("second"),std::string("first")}).IsValid());
+}
+
+TEST(PageSymbolVerifier,TestVerifyPureSymbols) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_symbol_verifier_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    json_content["elements"][0]["args"]["verify-effort"] = "pure";
+    improc::DrawerFactory factory {};
+    factory.Register("qrcode",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<improc::QrCodeDrawer>});
+    improc::PageDrawer drawer {factory,json_content};
+    std::list<std::optional<improc::DrawerVariant>> context {std::string("first"),std::string("second")};
+    cv::Mat page_image = drawer.Allocate().Draw(context).clone();
+
+    improc::PageSymbolVerifier verifier {drawer.get_render_plan(),{{"qrcode",ZXing::BarcodeFormat::QRCode}}};
+    EXPECT_EQ(verifier.get_page_pass_elements(),std::vector<bool>({false,true}));
+    EXPECT_TRUE(verifier.Verify(page_image,context).IsValid());
+}
@@ -5,6 +5,8 @@
 #include <improc/drawer/drawer_types/qrcode_drawer.hpp>
 #include <improc/infrastructure/filesystem/file.hpp>
 
+#include <opencv2/imgproc.hpp>
+
 TEST(ErrorCorrectionLevel,TestEmptyConstructor) {
     improc::qrcode::ErrorCorrectionLevel ecc {};
     EXPECT_EQ(ecc,improc::qrcode::ErrorCorrectionLevel::Value::kLow);
@@ -70,6 +72,23 @@ TEST(ErrorCorrectionLevel,TestToQrCodeGen) {
     EXPECT_EQ(ecc_high.ToQrCodeGen()    ,qrcodegen::QrCode::Ecc::HIGH);
 }
 
+TEST(SegmentMode,TestConstructor) {
+    EXPECT_EQ(improc::qrcode::SegmentMode(),improc::qrcode::SegmentMode::Value::kAuto);
+    EXPECT_EQ(improc::qrcode::SegmentMode("numeric")     ,improc::qrcode::SegmentMode::Value::kNumeric);
+    EXPECT_EQ(improc::qrcode::SegmentMode("ALPHANUMERIC"),improc::qrcode::SegmentMode::Value::kAlphanumeric);
+    EXPECT_EQ(improc::qrcode::SegmentMode("byte")        ,improc::qrcode::SegmentMode::Value::kByte);
+    EXPECT_EQ(improc::qrcode::SegmentMode("auto").ToString(),"Auto");
+    EXPECT_THROW(improc::qrcode::SegmentMode {"invalid"},std::out_of_range);
+}
+
+TEST(EncoderType,TestConstructor) {
+    EXPECT_EQ(improc::qrcode::EncoderType(),improc::qrcode::EncoderType::Value::kQrCodeGen);
+    EXPECT_EQ(improc::qrcode::EncoderType("qrcodegen"),improc::qrcode::EncoderType::Value::kQrCodeGen);
+    EXPECT_EQ(improc::qrcode::EncoderType("BUILTIN")  ,improc::qrcode::EncoderType::Value::kBuiltin);
+    EXPECT_EQ(improc::qrcode::EncoderType("builtin").ToString(),"Built-in");
+    EXPECT_THROW(improc::qrcode::EncoderType {"invalid"},std::out_of_range);
+}
+
 TEST(QrCodeDrawer,TestConstructor) {
     EXPECT_NO_THROW(improc::QrCodeDrawer());
 }
@@ -114,3 +133,204 @@ TEST(QrCodeDrawer,TestDraw) {
     EXPECT_TRUE(drawer.Verify(test_mat,"test_message"));
     EXPECT_FALSE(drawer.Verify(false_mat,"test_message"));
 }
+
+TEST(QrCodeDrawer,TestDrawInto) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/qrcode_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::QrCodeDrawer drawer {};
+    drawer.Load(json_content);
+    cv::Mat page = cv::Mat::zeros(21 + 10,21 + 10,CV_8UC1);
+    cv::Mat roi  = page(cv::Rect(5,5,21,21));
+    drawer.DrawInto(roi,"test_message");
+    EXPECT_EQ(cv::norm(roi,drawer.Draw("test_message"),cv::NORM_L1),0);
+    EXPECT_TRUE(drawer.Verify(roi.clone(),"test_message"));
+    cv::Mat invalid_roi = page(cv::Rect(0,0,21 - 1,21));
+    EXPECT_THROW(drawer.DrawInto(invalid_roi,"test_message"),improc::value_error);
+}
+
+TEST(QrCodeDrawer,TestVerifyEffort) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/qrcode_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::QrCodeDrawer pure_drawer {json_content};
+    EXPECT_EQ(pure_drawer.get_verify_effort(),improc::VerifyEffort::kPure);
+    json_content["verify-effort"] = "robust";
+    improc::QrCodeDrawer robust_drawer {json_content};
+    EXPECT_EQ(robust_drawer.get_verify_effort(),improc::VerifyEffort::kRobust);
+
+    cv::Mat scan_image (21 * 4 + 40,21 * 4 + 40,CV_8UC1,cv::Scalar(255));
+    cv::Mat scan_roi = scan_image(cv::Rect(20,20,21 * 4,21 * 4));
+    cv::resize(pure_drawer.Draw("test_message"),scan_roi,scan_roi.size(),0,0,cv::INTER_NEAREST);
+    EXPECT_TRUE(robust_drawer.Verify(scan_image,"test_message"));
+    EXPECT_FALSE(robust_drawer.Verify(scan_image,"other_message"));
+    EXPECT_FALSE(pure_drawer.Verify(scan_image,"test_message"));
+    EXPECT_TRUE(pure_drawer.Verify(pure_drawer.Draw("test_message"),"test_message"));
+}
+
+TEST(QrCodeDrawer,TestGetOutputSize) {
+    std::vector<std::string> messages    { "1", "test_message", "HELLO WORLD 0123456789"
+                                         , std::string(100,'a'), std::string(500,'7'), std::string(1000,'B'), std::string(1200,'c') };
+    std::vector<std::string> ecc_levels  {"low","medium","quartile","high"};
+    for (const std::string& ecc_level : ecc_levels)
+    {
+        Json::Value json_content {};
+        json_content["error-correction-level"] = ecc_level;
+        improc::QrCodeDrawer drawer {json_content};
+        for (const std::string& message : messages)
+        {
+            EXPECT_EQ(drawer.GetOutputSize(message),drawer.Draw(message).size());
+        }
+    }
+}
+
+TEST(QrCodeDrawer,TestGetOutputSizeTooLong) {
+    Json::Value json_content {};
+    json_content["error-correction-level"] = "high";
+    improc::QrCodeDrawer drawer {json_content};
+    EXPECT_THROW(drawer.GetOutputSize(std::string(4000,'a')),qrcodegen::data_too_long);
+    EXPECT_THROW(drawer.GetOutputSize(),std::bad_optional_access);
+}
+
+TEST(QrCodeDrawer,TestPinnedVersion) {
+    Json::Value json_content {};
+    json_content["error-correction-level"] = "medium";
+    json_content["min-version"] = 5;
+    json_content["max-version"] = 5;
+    improc::QrCodeDrawer drawer {json_content};
+    EXPECT_EQ(drawer.get_min_version(),5);
+    EXPECT_EQ(drawer.get_max_version(),5);
+    EXPECT_EQ(drawer.GetOutputSize(std::string("1")),cv::Size(37,37));
+    EXPECT_EQ(drawer.Draw(std::string(50,'a')).size(),cv::Size(37,37));
+    EXPECT_TRUE(drawer.Verify(drawer.Draw(std::string("1")),std::string("1")));
+    EXPECT_THROW(drawer.GetOutputSize(std::string(200,'a')),qrcodegen::data_too_long);
+    EXPECT_THROW(drawer.Draw(std::string(200,'a')),qrcodegen::data_too_long);
+
+    json_content["min-version"] = 6;
+    EXPECT_THROW(improc::QrCodeDrawer {json_content},improc::value_error);
+    json_content["min-version"] = 0;
+    EXPECT_THROW(improc::QrCodeDrawer {json_content},improc::value_error);
+    json_content["min-version"] = 1;
+    json_content["max-version"] = 41;
+    EXPECT_THROW(improc::QrCodeDrawer {json_content},improc::value_error);
+}
+
+TEST(QrCodeDrawer,TestPinnedMask) {
+    Json::Value json_content {};
+    json_content["error-correction-level"] = "low";
+    improc::QrCodeDrawer auto_drawer {json_content};
+    EXPECT_FALSE(auto_drawer.get_mask().has_value());
+    json_content["mask"] = 0;
+    improc::QrCodeDrawer mask_0_drawer {json_content};
+    json_content["mask"] = 1;
+    improc::QrCodeDrawer mask_1_drawer {json_content};
+    EXPECT_EQ(mask_1_drawer.get_mask(),1);
+    cv::Mat mask_0_image = mask_0_drawer.Draw(std::string("test_message"));
+    cv::Mat mask_1_image = mask_1_drawer.Draw(std::string("test_message"));
+    EXPECT_GT(cv::norm(mask_0_image,mask_1_image,cv::NORM_L1),0);
+    EXPECT_TRUE(mask_0_drawer.Verify(mask_0_image,std::string("test_message")));
+    EXPECT_TRUE(mask_1_drawer.Verify(mask_1_image,std::string("test_message")));
+
+    json_content["mask"] = 8;
+    EXPECT_THROW(improc::QrCodeDrawer {json_content},improc::value_error);
+    json_content["mask"] = -1;
+    EXPECT_THROW(improc::QrCodeDrawer {json_content},improc::value_error);
+}
+
+TEST(QrCodeDrawer,TestSegmentMode) {
+    Json::Value json_content {};
+    json_content["error-correction-level"] = "low";
+    improc::QrCodeDrawer auto_drawer {json_content};
+    EXPECT_EQ(auto_drawer.get_segment_mode(),improc::qrcode::SegmentMode::Value::kAuto);
+    std::optional<improc::DrawerVariant> numeric_message {std::vector<unsigned int>({1,2,3,4})};
+    std::optional<improc::DrawerVariant> alphanumeric_message {std::vector<unsigned int>({10,11,36,1})};
+    EXPECT_EQ(cv::norm(auto_drawer.Draw(numeric_message),auto_drawer.Draw(std::string("1234")),cv::NORM_L1),0);
+    EXPECT_TRUE(auto_drawer.Verify(auto_drawer.Draw(numeric_message),numeric_message));
+    EXPECT_TRUE(auto_drawer.Verify(auto_drawer.Draw(alphanumeric_message),std::string("AB 1")));
+    EXPECT_THROW(auto_drawer.Draw(std::vector<unsigned int>({45})),improc::value_error);
+
+    json_content["segment-mode"] = "numeric";
+    improc::QrCodeDrawer numeric_drawer {json_content};
+    EXPECT_TRUE(numeric_drawer.Verify(numeric_drawer.Draw(numeric_message),numeric_message));
+    EXPECT_THROW(numeric_drawer.Draw(alphanumeric_message),improc::value_error);
+    EXPECT_THROW(numeric_drawer.Draw(std::string("abc")),improc::value_error);
+
+    json_content["segment-mode"] = "alphanumeric";
+    improc::QrCodeDrawer alphanumeric_drawer {json_content};
+    EXPECT_TRUE(alphanumeric_drawer.Verify(alphanumeric_drawer.Draw(numeric_message),std::string("1234")));
+    EXPECT_THROW(alphanumeric_drawer.Draw(std::string("abc")),improc::value_error);
+
+    json_content["segment-mode"] = "byte";
+    improc::QrCodeDrawer byte_drawer {json_content};
+    EXPECT_TRUE(byte_drawer.Verify(byte_drawer.Draw(std::vector<unsigned int>({97,98})),std::string("ab")));
+    EXPECT_EQ(byte_drawer.GetOutputSize(std::string("1234")),byte_drawer.Draw(std::string("1234")).size());
+}
+
+TEST(QrCodeDrawer,TestVerifyBytePayload) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/qrcode_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    std::vector<std::byte> byte_payload {std::byte{0xC3},std::byte{0x28},std::byte{0xFF},std::byte{0x00},std::byte{0x80}};
+    std::vector<std::byte> other_payload {std::byte{0xC3},std::byte{0x28},std::byte{0xFE},std::byte{0x00},std::byte{0x80}};
+    improc::QrCodeDrawer pure_drawer {json_content};
+    cv::Mat drawer_output = pure_drawer.Draw(byte_payload);
+    EXPECT_TRUE(pure_drawer.Verify(drawer_output,byte_payload));
+    EXPECT_FALSE(pure_drawer.Verify(drawer_output,other_payload));
+
+    json_content["verify-effort"] = "robust";
+    improc::QrCodeDrawer robust_drawer {json_content};
+    cv::Mat scan_image (drawer_output.rows * 4 + 40,drawer_output.cols * 4 + 40,CV_8UC1,cv::Scalar(255));
+    cv::Mat scan_roi = scan_image(cv::Rect(20,20,drawer_output.cols * 4,drawer_output.rows * 4));
+    cv::resize(drawer_output,scan_roi,scan_roi.size(),0,0,cv::INTER_NEAREST);
+    EXPECT_TRUE(robust_drawer.Verify(scan_image,byte_payload));
+    EXPECT_FALSE(robust_drawer.Verify(scan_image,other_payload));
+
+    json_content["verify-effort"] = "pure";
+    json_content["segment-mode"]  = "byte";
+    improc::QrCodeDrawer byte_drawer {json_content};
+    std::vector<unsigned int> index_payload {0xC3,0x28,0xFF,0x00,0x80};
+    EXPECT_TRUE(byte_drawer.Verify(byte_drawer.Draw(index_payload),index_payload));
+    EXPECT_TRUE(byte_drawer.Verify(byte_drawer.Draw(index_payload),byte_payload));
+}
+
+TEST(QrCodeDrawer,TestBuiltinEncoder) {
+    std::vector<std::optional<improc::DrawerVariant>> messages { std::string(""), std::string("1"), std::string("0123456789012")
+                                                               , std::string("HELLO WORLD $%*+-./:"), std::string("test_message")
+                                                               , std::string(1000,'7'), std::string(1200,'A'), std::string(800,'z')
+                                                               , std::vector<std::byte>({std::byte{0},std::byte{200},std::byte{49}})
+                                                               , std::vector<unsigned int>({1,2,3,4}) };
+    for (const std::string& error_correction_level : {"low","medium","quartile","high"})
+    {
+        for (const std::string& segment_mode : {"auto","byte"})
+        {
+            Json::Value json_content {};
+            json_content["error-correction-level"] = error_correction_level;
+            json_content["segment-mode"] = segment_mode;
+            improc::QrCodeDrawer qrcodegen_drawer {json_content};
+            json_content["encoder"] = "builtin";
+            improc::QrCodeDrawer builtin_drawer {json_content};
+            EXPECT_EQ(builtin_drawer.get_encoder_type(),improc::qrcode::EncoderType::Value::kBuiltin);
+            for (const std::optional<improc::DrawerVariant>& message : messages)
+            {
+                cv::Mat builtin_image = builtin_drawer.Draw(message);
+                ASSERT_EQ(builtin_image.size(),qrcodegen_drawer.Draw(message).size());
+                EXPECT_EQ(cv::norm(builtin_image,qrcodegen_drawer.Draw(message),cv::NORM_L1),0);
+                EXPECT_EQ(builtin_image.size(),builtin_drawer.GetOutputSize(message));
+            }
+        }
+    }
+
+    Json::Value json_content {};
+    json_content["error-correction-level"] = "medium";
+    json_content["min-version"] = 7;
+    json_content["max-version"] = 9;
+    json_content["mask"] = 3;
+    improc::QrCodeDrawer qrcodegen_drawer {json_content};
+    json_content["encoder"] = "builtin";
+    improc::QrCodeDrawer builtin_drawer {json_content};
+    cv::Mat builtin_image = builtin_drawer.Draw(std::string("test_message"));
+    EXPECT_EQ(cv::norm(builtin_image,qrcodegen_drawer.Draw(std::string("test_message")),cv::NORM_L1),0);
+    EXPECT_TRUE(builtin_drawer.Verify(builtin_image,std::string("test_message")));
+    cv::Mat page_image (builtin_image.rows + 10,builtin_image.cols + 10,CV_8UC1,cv::Scalar(128));
+    cv::Mat roi = page_image(cv::Rect(5,5,builtin_image.cols,builtin_image.rows));
+    builtin_drawer.DrawInto(roi,std::string("test_message"));
+    EXPECT_EQ(cv::norm(roi,builtin_image,cv::NORM_L1),0);
+    EXPECT_THROW(builtin_drawer.Draw(std::string(500,'a')),qrcodegen::data_too_long);
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <improc_drawer_test_config.hpp>
+#include <base_drawers_def.hpp>
+#include <improc/drawer/engine/render_cache.hpp>
+#include <improc/drawer/engine/element_drawer.hpp>
+#include <improc/infrastructure/filesystem/file.hpp>
+
+TEST(RenderCache,TestConstructorWithJson) {
+    Json::Value json_content {};
+    EXPECT_THROW(improc::RenderCache{json_content},improc::json_error);
+    json_content["max-bytes"] = 0;
+    EXPECT_THROW(improc::RenderCache{json_content},improc::value_error);
+    json_content["max-bytes"] = -1;
+    EXPECT_THROW(improc::RenderCache{json_content},improc::value_error);
+    json_content["max-bytes"] = 1024;
+    EXPECT_EQ(improc::RenderCache(json_content).get_max_bytes(),1024);
+    if (sizeof(size_t) >= sizeof(std::uint64_t))
+    {
+        json_content["max-bytes"] = Json::UInt64(8589934592ULL);
+        EXPECT_EQ(improc::RenderCache(json_content).get_max_bytes(),8589934592ULL);
+    }
+}
+
+TEST(RenderCache,TestLeastRecentlyUsed) {
+    improc::RenderCache cache {400};
+    std::shared_ptr<const std::string> element_config = std::make_shared<const std::string>("element");
+    cv::Mat element_image       (10,20,CV_8UC1,cv::Scalar(1));
+    cv::Mat other_element_image (10,20,CV_8UC1,cv::Scalar(2));
+    EXPECT_FALSE(cache.Find(1,*element_config,std::string("a")).has_value());
+    cache.Insert(1,element_config,std::string("a"),element_image);
+    cache.Insert(2,element_config,std::string("b"),element_image);
+    EXPECT_EQ(cache.get_bytes(),400);
+    EXPECT_TRUE(cache.Find(1,*element_config,std::string("a")).has_value());
+
+    cache.Insert(3,element_config,std::string("c"),other_element_image);
+    EXPECT_EQ(cache.get_number_entries(),2);
+    EXPECT_FALSE(cache.Find(2,*element_config,std::string("b")).has_value());
+    EXPECT_EQ(cv::norm(cache.Find(3,*element_config,std::string("c")).value(),other_element_image,cv::NORM_L1),0);
+    EXPECT_EQ(cache.get_hits(),2);
+    EXPECT_EQ(cache.get_misses(),2);
+
+    cache.Insert(4,element_config,std::string("d"),cv::Mat(30,20,CV_8UC1));
+    EXPECT_FALSE(cache.Find(4,*element_config,std::string("d")).has_value());
+    cache.Clear();
+    EXPECT_EQ(cache.get_number_entries(),0);
+    EXPECT_EQ(cache.get_bytes(),0);
+    EXPECT_EQ(cache.get_hits(),0);
+}
+
+TEST(RenderCache,TestCollidingKeys) {
+    improc::RenderCache cache {1000};
+    std::shared_ptr<const std::string> element_config       = std::make_shared<const std::string>("element");
+    std::shared_ptr<const std::string> other_element_config = std::make_shared<const std::string>("other-element");
+    cv::Mat element_image       (10,20,CV_8UC1,cv::Scalar(1));
+    cv::Mat other_element_image (10,20,CV_8UC1,cv::Scalar(2));
+    cache.Insert(1,element_config,std::string("a"),element_image);
+    EXPECT_TRUE (cache.Find(1,std::string("element"),std::string("a")).has_value());
+    EXPECT_FALSE(cache.Find(1,*element_config,std::string("b")).has_value());
+    EXPECT_FALSE(cache.Find(1,*element_config,std::vector<std::byte>({std::byte('a')})).has_value());
+    EXPECT_FALSE(cache.Find(1,*element_config,std::nullopt).has_value());
+    EXPECT_FALSE(cache.Find(1,*other_element_config,std::string("a")).has_value());
+    EXPECT_EQ(cache.get_hits(),1);
+    EXPECT_EQ(cache.get_misses(),4);
+
+    cache.Insert(1,other_element_config,std::string("a"),other_element_image);
+    EXPECT_EQ(cache.get_number_entries(),1);
+    EXPECT_EQ(cache.get_bytes(),200);
+    EXPECT_FALSE(cache.Find(1,*element_config,std::string("a")).has_value());
+    EXPECT_EQ(cv::norm(cache.Find(1,*other_element_config,std::string("a")).value(),other_element_image,cv::NORM_L1),0);
+}
+
+TEST(RenderCache,TestPeekWithoutStatistics) {
+    improc::RenderCache cache {400};
+    std::shared_ptr<const std::string> element_config = std::make_shared<const std::string>("element");
+    cv::Mat element_image (10,20,CV_8UC1,cv::Scalar(1));
+    cache.Insert(1,element_config,std::string("a"),element_image);
+    cache.Insert(2,element_config,std::string("b"),element_image);
+    EXPECT_TRUE (cache.Peek(1,*element_config,std::string("a")).has_value());
+    EXPECT_FALSE(cache.Peek(3,*element_config,std::string("c")).has_value());
+    EXPECT_EQ(cache.get_hits(),0);
+    EXPECT_EQ(cache.get_misses(),0);
+
+    // Peeking does not mark the element image as used, so it is still the least recently used one
+    cache.Insert(3,element_config,std::string("c"),element_image);
+    EXPECT_FALSE(cache.Peek(1,*element_config,std::string("a")).has_value());
+    EXPECT_TRUE (cache.Peek(2,*element_config,std::string("b")).has_value());
+}
+
+TEST(RenderCache,TestElementDrawerCache) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/element_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    json_content["render-cache"]["max-bytes"] = 1000;
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestMessageDrawer>});
+    improc::ElementDrawer drawer {factory,json_content};
+    std::shared_ptr<improc::RenderCache> cache = drawer.get_render_cache();
+    ASSERT_NE(cache,nullptr);
+    EXPECT_EQ(drawer.get_drawer_type(),"test_drawer");
+
+    cv::Mat element_image = drawer.Draw(std::string("a"));
+    EXPECT_EQ(cv::norm(drawer.Draw(std::string("a")),element_image,cv::NORM_L1),0);
+    cv::Mat page_image (50,50,CV_8UC1,cv::Scalar(255));
+    cv::Mat roi = page_image(cv::Rect(5,5,element_image.cols,element_image.rows));
+    drawer.DrawInto(roi,std::string("a"));
+    EXPECT_EQ(cv::norm(roi,element_image,cv::NORM_L1),0);
+    EXPECT_EQ(cache->get_hits(),2);
+    EXPECT_EQ(cache->get_misses(),1);
+
+    drawer.Draw(std::string("bb"));
+    EXPECT_EQ(cache->get_number_entries(),1);
+    EXPECT_FALSE(cache->Find(0,std::string(),std::nullopt).has_value());
+    cv::Mat wrong_roi = page_image(cv::Rect(0,0,10,10));
+    EXPECT_THROW(drawer.DrawInto(wrong_roi,std::string("bb")),improc::value_error);
+
+    json_content["exact-verification"]["tolerance"] = 0;
+    improc::ElementDrawer exact_drawer {factory,json_content};
+    std::shared_ptr<improc::RenderCache> exact_cache = exact_drawer.get_render_cache();
+    cv::Mat exact_image = exact_drawer.Draw(std::string("a"));
+    EXPECT_TRUE(exact_drawer.Verify(exact_image,std::string("a")));
+    EXPECT_EQ(exact_cache->get_hits(),0);
+    EXPECT_EQ(exact_cache->get_misses(),1);
+}
+
+TEST(RenderCache,TestPageRenderCache) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_element_ids.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_message_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestMessageDrawer>});
+    improc::PageDrawer uncached_drawer {factory,json_content};
+    json_content["render-cache"]["drawer-type"] = "test_message_drawer";
+    json_content["render-cache"]["max-bytes"]   = 4096;
+    improc::PageDrawer drawer {factory,json_content};
+    std::shared_ptr<improc::RenderCache> cache = drawer.get_page_elements()[0].get_element_drawer().get_render_cache();
+    ASSERT_NE(cache,nullptr);
+    for (const improc::PageElementDrawer& elem : drawer.get_page_elements())
+    {
+        EXPECT_EQ(elem.get_element_drawer().get_render_cache(),cache);
+    }
+
+    std::list<std::optional<improc::DrawerVariant>> context {std::string("aa"),std::string("aa"),std::string("c"),std::nullopt};
+    cv::Mat expected_page = uncached_drawer.Allocate().Draw(context).clone();
+    cv::Mat page_image    = drawer.Allocate().Draw(context);
+    EXPECT_EQ(cv::norm(page_image,expected_page,cv::NORM_L1),0);
+    size_t hits = cache->get_hits();
+    EXPECT_GE(hits,1);
+    drawer.Draw(context);
+    EXPECT_EQ(cache->get_hits(),hits + 3);
+
+    json_content["render-cache"].removeMember("drawer-type");
+    EXPECT_THROW(improc::PageDrawer(factory,json_content),improc::json_error);
+}
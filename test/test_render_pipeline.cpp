@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <improc_drawer_test_config.hpp>
+#include <base_drawers_def.hpp>
+#include <improc/drawer/render_pipeline.hpp>
+#include <improc/infrastructure/filesystem/file.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+TEST(RenderPipeline,TestConstructor) {
+    improc::PageDrawer drawer {};
+    improc::RenderPipeline pipeline {drawer,2,4};
+    EXPECT_EQ(pipeline.get_number_workers(),2);
+    EXPECT_EQ(pipeline.get_capacity(),4);
+}
+
+TEST(RenderPipeline,TestInvalidNumberWorkers) {
+    improc::PageDrawer drawer {};
+    EXPECT_THROW(improc::RenderPipeline(drawer,0,4),improc::value_error);
+}
+
+TEST(RenderPipeline,TestInvalidCapacity) {
+    improc::PageDrawer drawer {};
+    EXPECT_THROW(improc::RenderPipeline(drawer,2,0),improc::value_error);
+}
+
+TEST(RenderPipeline,TestRunInOrder) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    drawer.Allocate();
+    improc::RenderPipeline::PageContext context {};
+    context.push_back("test_a");
+    context.emplace_back();
+    context.emplace_back();
+    cv::Mat expected_page = drawer.Draw(context).clone();
+
+    static constexpr size_t kNumberPages = 100;
+    size_t number_produced = 0;
+    std::vector<size_t> delivered_pages {};
+    improc::RenderPipeline pipeline {drawer,3,4};
+    size_t number_delivered = pipeline.Run  ( [&number_produced,&context] () -> std::optional<improc::RenderPipeline::PageContext>
+                                                {
+                                                    if (number_produced == kNumberPages)
+                                                    {
+                                                        return std::nullopt;
+                                                    }
+                                                    number_produced++;
+                                                    return context;
+                                                }
+                                            , [&delivered_pages,&expected_page] (size_t page_idx, const cv::Mat& page_image)
+                                                {
+                                                    EXPECT_EQ(cv::norm(page_image,expected_page,cv::NORM_L1),0);
+                                                    delivered_pages.push_back(page_idx);
+                                                }
+                                            );
+    EXPECT_EQ(number_delivered,kNumberPages);
+    ASSERT_EQ(delivered_pages.size(),kNumberPages);
+    for (size_t page_idx = 0; page_idx < kNumberPages; page_idx++)
+    {
+        EXPECT_EQ(delivered_pages[page_idx],page_idx);
+    }
+}
+
+TEST(RenderPipeline,TestRunWithoutAllocate) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    bool produced = false;
+    improc::RenderPipeline pipeline {drawer,2,2};
+    EXPECT_THROW(pipeline.Run   ( [&produced] () -> std::optional<improc::RenderPipeline::PageContext>
+                                    {
+                                        if (produced == true)
+                                        {
+                                            return std::nullopt;
+                                        }
+                                        produced = true;
+                                        return improc::RenderPipeline::PageContext(3);
+                                    }
+                                , [] (size_t page_idx, const cv::Mat& page_image) {}
+                                )
+                , improc::processing_flow_error );
+}
+
+TEST(RenderPipeline,TestSinkException) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    drawer.Allocate();
+    improc::RenderPipeline pipeline {drawer,2,2};
+    EXPECT_THROW(pipeline.Run   ( [] () -> std::optional<improc::RenderPipeline::PageContext> {return improc::RenderPipeline::PageContext(3);}
+                                , [] (size_t page_idx, const cv::Mat& page_image) {if (page_idx == 10) {throw improc::value_error("sink error");}}
+                                )
+                , improc::value_error );
+}
+
+TEST(RenderPipeline,TestRunWithRenderPlan) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    improc::RenderPipeline::PageContext context {};
+    context.push_back("test_a");
+    context.emplace_back();
+    context.emplace_back();
+    cv::Mat expected_page = drawer.Allocate().Draw(context).clone();
+
+    static constexpr size_t kNumberPages = 20;
+    size_t number_produced = 0;
+    size_t number_valid    = 0;
+    improc::RenderPipeline pipeline {drawer.get_render_plan(),2,3};
+    drawer.Load(factory,json_content);
+    size_t number_delivered = pipeline.Run  ( [&number_produced,&context] () -> std::optional<improc::RenderPipeline::PageContext>
+                                                {
+                                                    if (number_produced == kNumberPages)
+                                                    {
+                                                        return std::nullopt;
+                                                    }
+                                                    number_produced++;
+                                                    return context;
+                                                }
+                                            , [&number_valid,&expected_page] (size_t page_idx, const cv::Mat& page_image)
+                                                {
+                                                    if (cv::norm(page_image,expected_page,cv::NORM_L1) == 0)
+                                                    {
+                                                        number_valid++;
+                                                    }
+                                                }
+                                            );
+    EXPECT_EQ(number_delivered,kNumberPages);
+    EXPECT_EQ(number_valid,kNumberPages);
+    EXPECT_THROW(improc::RenderPipeline(std::shared_ptr<const improc::RenderPlan>(),2,3),improc::processing_flow_error);
+}
+
+TEST(RenderPipeline,TestStalledSinkWaits) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    drawer.Allocate();
+
+    // While the sink stalls, the producer waits for it: at most capacity pages are in flight plus the context being started.
+    static constexpr size_t kNumberPages = 10;
+    static constexpr size_t kCapacity    = 2;
+    std::atomic<size_t> number_produced {0};
+    size_t max_pages_ahead = 0;
+    improc::RenderPipeline pipeline {drawer,3,kCapacity};
+    size_t number_delivered = pipeline.Run  ( [&number_produced] () -> std::optional<improc::RenderPipeline::PageContext>
+                                                {
+                                                    if (number_produced.load() == kNumberPages)
+                                                    {
+                                                        return std::nullopt;
+                                                    }
+                                                    number_produced++;
+                                                    return improc::RenderPipeline::PageContext {std::string("test_a"),std::nullopt,std::nullopt};
+                                                }
+                                            , [&number_produced,&max_pages_ahead] (size_t page_idx, const cv::Mat& page_image)
+                                                {
+                                                    if (page_idx == 0)
+                                                    {
+                                                        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                                                    }
+                                                    max_pages_ahead = std::max(max_pages_ahead,number_produced.load() - page_idx);
+                                                }
+                                            );
+    EXPECT_EQ(number_delivered,kNumberPages);
+    EXPECT_LE(max_pages_ahead,kCapacity + 1);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <improc_drawer_test_config.hpp>
+#include <base_drawers_def.hpp>
+#include <improc/drawer/engine/render_plan.hpp>
+#include <improc/drawer/engine/grid_drawer.hpp>
+#include <improc/infrastructure/filesystem/file.hpp>
+
+TEST(RenderPlan,TestNoRenderPlanWithoutAllocation) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    EXPECT_EQ(drawer.get_render_plan(),nullptr);
+    EXPECT_NE(drawer.Allocate().get_render_plan(),nullptr);
+    EXPECT_EQ(drawer.Load(factory,json_content).get_render_plan(),nullptr);
+}
+
+TEST(RenderPlan,TestUnallocatedPageElements) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    cv::Size page_size = drawer.get_page_size();
+    cv::Mat  background (page_size,improc::BaseDrawer::kImageDataType,improc::BaseDrawer::kWhiteValue);
+    EXPECT_THROW(improc::RenderPlan(page_size,background,drawer.get_page_elements()),improc::processing_flow_error);
+    EXPECT_THROW(improc::RenderPlan(page_size,cv::Mat(),drawer.get_page_elements()),improc::value_error);
+}
+
+TEST(RenderPlan,TestDrawAndVerify) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::list<std::optional<improc::DrawerVariant>> context {};
+    context.push_back("test_a");
+    context.emplace_back();
+    context.emplace_back();
+    std::shared_ptr<const improc::RenderPlan> render_plan = drawer.Allocate().get_render_plan();
+    cv::Mat background    = render_plan->get_background().clone();
+    cv::Mat expected_page = drawer.Draw(context).clone();
+    EXPECT_EQ(cv::norm(render_plan->get_background(),background,cv::NORM_L1),0);
+
+    cv::Mat page_image {};
+    render_plan->Draw(page_image,context);
+    EXPECT_EQ(render_plan->get_number_elements(),3);
+    EXPECT_EQ(render_plan->get_page_size(),drawer.get_page_size());
+    EXPECT_EQ(cv::norm(page_image,expected_page,cv::NORM_L1),0);
+    EXPECT_TRUE(render_plan->Verify(page_image,context));
+    EXPECT_THROW(render_plan->Draw(page_image,std::list<std::optional<improc::DrawerVariant>>()),improc::value_error);
+    EXPECT_THROW(render_plan->Verify(page_image,std::list<std::optional<improc::DrawerVariant>>()),improc::value_error);
+}
+
+TEST(RenderPlan,TestDrawerTable) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/grid_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestGridDrawer>});
+    improc::GridDrawer drawer = improc::GridDrawer(factory,json_content);
+    std::shared_ptr<const improc::RenderPlan> render_plan = drawer.Allocate().get_render_plan();
+    EXPECT_EQ(render_plan->get_number_elements(),24);
+    EXPECT_EQ(render_plan->get_number_drawers(),3);
+    EXPECT_EQ(render_plan->get_element_boxes()[3],cv::Rect(10,415,50,100));
+    EXPECT_EQ(render_plan->get_draw_levels().size(),1);
+    EXPECT_EQ(render_plan->get_draw_levels()[0].size(),8);
+}
+
+TEST(RenderPlan,TestDrawAndVerifyContextView) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::list<std::optional<improc::DrawerVariant>> context {};
+    context.push_back("test_a");
+    context.emplace_back();
+    context.emplace_back();
+    cv::Mat expected_page = drawer.Allocate().Draw(context).clone();
+
+    std::string message {"test_a"};
+    std::vector<std::optional<improc::DrawerVariantView>> context_view (3);
+    context_view[0] = std::string_view(message);
+    cv::Mat page_image {};
+    drawer.Draw(page_image,context_view);
+    EXPECT_EQ(cv::norm(page_image,expected_page,cv::NORM_L1),0);
+    EXPECT_TRUE(drawer.Verify(page_image,context_view));
+
+    uchar* page_data = page_image.data;
+    drawer.Draw(page_image,context_view);
+    EXPECT_EQ(page_image.data,page_data);
+    EXPECT_EQ(cv::norm(page_image,expected_page,cv::NORM_L1),0);
+    EXPECT_THROW(drawer.Draw(page_image,improc::DrawerContextView()),improc::value_error);
+    EXPECT_THROW(drawer.Verify(cv::Mat(),improc::DrawerContextView(context_view)),improc::value_error);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <improc_drawer_test_config.hpp>
+#include <base_drawers_def.hpp>
+#include <improc/drawer/engine/render_plan_cache.hpp>
+#include <improc/drawer/engine/page_drawer.hpp>
+#include <improc/infrastructure/filesystem/file.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    std::string GetCacheFilepath(const std::string& cache_filename)
+    {
+        std::string cache_filepath = (std::filesystem::temp_directory_path() / cache_filename).string();
+        std::filesystem::remove(cache_filepath);
+        return cache_filepath;
+    }
+}
+
+TEST(RenderPlanCache,TestComputeKey) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    Json::Value json_changed  = json_content;
+    json_changed["page-size"]["width"] = json_changed["page-size"]["width"].asInt() + 1;
+    EXPECT_EQ(improc::RenderPlanCache::ComputeKey(json_content),improc::RenderPlanCache::ComputeKey(json_content));
+    EXPECT_NE(improc::RenderPlanCache::ComputeKey(json_content),improc::RenderPlanCache::ComputeKey(json_changed));
+}
+
+TEST(RenderPlanCache,TestReadMissingCache) {
+    improc::RenderPlanCache render_plan_cache {GetCacheFilepath("improc_drawer_missing_cache.bin"),0};
+    EXPECT_FALSE(render_plan_cache.Read().has_value());
+}
+
+TEST(RenderPlanCache,TestWriteAndRead) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::shared_ptr<const improc::RenderPlan> render_plan = drawer.Allocate().get_render_plan();
+
+    std::string cache_filepath = GetCacheFilepath("improc_drawer_write_cache.bin");
+    improc::RenderPlanCache render_plan_cache {cache_filepath,json_content};
+    render_plan_cache.Write(*render_plan);
+    std::optional<improc::RenderPlanCache::CachedAllocation> cached_allocation = render_plan_cache.Read();
+    ASSERT_TRUE(cached_allocation.has_value());
+    EXPECT_EQ(cached_allocation->page_size,render_plan->get_page_size());
+    EXPECT_EQ(cached_allocation->element_boxes,render_plan->get_element_boxes());
+    EXPECT_EQ(cached_allocation->element_scales,render_plan->get_element_scales());
+    EXPECT_EQ(cached_allocation->static_elements,render_plan->get_static_elements());
+    EXPECT_EQ(cv::norm(cached_allocation->background,render_plan->get_background(),cv::NORM_L1),0);
+    EXPECT_FALSE(improc::RenderPlanCache(cache_filepath,render_plan_cache.get_key() + 1).Read().has_value());
+    std::filesystem::remove(cache_filepath);
+}
+
+TEST(RenderPlanCache,TestReadTruncatedCache) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::string cache_filepath = GetCacheFilepath("improc_drawer_truncated_cache.bin");
+    improc::RenderPlanCache render_plan_cache {cache_filepath,json_content};
+    render_plan_cache.Write(*drawer.Allocate().get_render_plan());
+    std::filesystem::resize_file(cache_filepath,std::filesystem::file_size(cache_filepath) - 1);
+    EXPECT_FALSE(render_plan_cache.Read().has_value());
+    std::filesystem::remove(cache_filepath);
+}
+
+TEST(RenderPlanCache,TestWriteFailureRemovesTemporaryFile) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    improc::PageDrawer drawer = improc::PageDrawer(factory,json_content);
+    std::string cache_filename = "improc_drawer_directory_cache.bin";
+    std::string cache_filepath = GetCacheFilepath(cache_filename);
+    std::filesystem::create_directory(cache_filepath);
+    improc::RenderPlanCache render_plan_cache {cache_filepath,json_content};
+    render_plan_cache.Write(*drawer.Allocate().get_render_plan());
+    EXPECT_TRUE(std::filesystem::is_directory(cache_filepath));
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(std::filesystem::temp_directory_path()))
+    {
+        std::string filename = entry.path().filename().string();
+        EXPECT_FALSE(filename.size() > cache_filename.size() && filename.compare(0,cache_filename.size() + 1,cache_filename + ".") == 0);
+    }
+    std::filesystem::remove(cache_filepath);
+}
+
+TEST(RenderPlanCache,TestAllocateFromCache) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/page_drawer_multiple_elem.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::DrawerFactory factory {};
+    factory.Register("test_drawer",std::function<std::shared_ptr<improc::BaseDrawer>(const Json::Value&)> {&improc::CreateDrawer<TestPageDrawer>});
+    std::list<std::optional<improc::DrawerVariant>> context {};
+    context.push_back("test_a");
+    context.emplace_back();
+    context.emplace_back();
+
+    std::string cache_filepath = GetCacheFilepath("improc_drawer_allocate_cache.bin");
+    improc::RenderPlanCache render_plan_cache {cache_filepath,json_content};
+    improc::PageDrawer cold_drawer = improc::PageDrawer(factory,json_content);
+    cv::Mat expected_page = cold_drawer.Allocate(render_plan_cache).Draw(context).clone();
+    EXPECT_TRUE(std::filesystem::exists(cache_filepath));
+
+    // Drawing the background in the cache proves the warm start uses it instead of drawing the static elements again.
+    std::optional<improc::RenderPlanCache::CachedAllocation> cached_allocation = render_plan_cache.Read();
+    ASSERT_TRUE(cached_allocation.has_value());
+    cached_allocation->background.setTo(0);
+    improc::RenderPlan marked_render_plan {cached_allocation->page_size,cached_allocation->background,cold_drawer.get_page_elements()};
+    render_plan_cache.Write(marked_render_plan);
+
+    improc::PageDrawer warm_drawer = improc::PageDrawer(factory,json_content);
+    std::shared_ptr<const improc::RenderPlan> warm_render_plan = warm_drawer.Allocate(render_plan_cache).get_render_plan();
+    ASSERT_NE(warm_render_plan,nullptr);
+    EXPECT_EQ(warm_render_plan->get_element_boxes(),cold_drawer.get_render_plan()->get_element_boxes());
+    EXPECT_EQ(cv::countNonZero(warm_render_plan->get_background()),0);
+    EXPECT_EQ(warm_drawer.Draw(context).size(),expected_page.size());
+    std::filesystem::remove(cache_filepath);
+}
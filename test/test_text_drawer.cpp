@@ -3,6 +3,7 @@
 #include <improc_drawer_test_config.hpp>
 
 #include <improc/drawer/drawer_types/text_drawer.hpp>
+#include <improc/drawer/engine/worker_pool.hpp>
 #include <improc/infrastructure/filesystem/file.hpp>
 
 TEST(TextDrawer,TestConstructor) {
@@ -111,3 +112,39 @@ TEST(TextDrawer,TestDrawGrayscale) {
     EXPECT_EQ(test_mat.cols,197);
     EXPECT_TRUE(drawer.Verify(test_mat));
 }
+
+TEST(TextDrawer,TestConcurrentDraw) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/text_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    const improc::TextDrawer drawer {json_content};
+    cv::Mat expected_mat = drawer.Draw("test");
+    std::vector<cv::Mat> test_mats (16);
+    improc::WorkerPool pool {4};
+    pool.Run(test_mats.size(),[&drawer,&test_mats] (size_t mat_idx) {test_mats[mat_idx] = drawer.Draw("test");});
+    for (const cv::Mat& test_mat : test_mats)
+    {
+        EXPECT_EQ(cv::countNonZero(test_mat != expected_mat),0);
+        EXPECT_TRUE(drawer.Verify(test_mat));
+    }
+}
+
+TEST(TextDrawer,TestDrawInto) {
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/text_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::TextDrawer drawer {json_content};
+    cv::Mat page = cv::Mat::zeros(128,207,CV_8UC1);
+    cv::Mat roi  = page(cv::Rect(5,5,197,118));
+    drawer.DrawInto(roi,"test");
+    EXPECT_EQ(cv::norm(roi,drawer.Draw("test"),cv::NORM_L1),0);
+    cv::Mat invalid_roi = page(cv::Rect(0,0,100,100));
+    EXPECT_THROW(drawer.DrawInto(invalid_roi,"test"),improc::value_error);
+}
+
+TEST(TextDrawer,TestGetOutputSize) {
+    EXPECT_THROW(improc::TextDrawer().GetOutputSize("test"),improc::value_error);
+    std::string json_filepath = std::string(IMPROC_DRAWER_TEST_FOLDER) + "/test/data/text_drawer_config.json";
+    Json::Value json_content  = improc::JsonFile::Read(json_filepath);
+    improc::TextDrawer drawer {json_content};
+    EXPECT_EQ(drawer.GetOutputSize("test"),cv::Size(197,118));
+    EXPECT_EQ(drawer.GetOutputSize(),cv::Size(197,118));
+}
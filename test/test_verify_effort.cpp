@@ -0,0 +1,21 @@
+#include <gtest/gtest.h>
+
+#include <improc/drawer/engine/verify_effort.hpp>
+
+TEST(VerifyEffort,TestEmptyConstructor) {
+    improc::VerifyEffort verify_effort {};
+    EXPECT_EQ(verify_effort,improc::VerifyEffort::Value::kPure);
+}
+
+TEST(VerifyEffort,TestConstructorFromString) {
+    improc::VerifyEffort verify_effort_pure   {"pure"};
+    improc::VerifyEffort verify_effort_robust {"ROBUST"};
+    EXPECT_EQ(verify_effort_pure,improc::VerifyEffort::Value::kPure);
+    EXPECT_EQ(verify_effort_robust,improc::VerifyEffort::Value::kRobust);
+    EXPECT_THROW(improc::VerifyEffort verify_effort {"invalid"},std::out_of_range);
+}
+
+TEST(VerifyEffort,TestToString) {
+    EXPECT_EQ(improc::VerifyEffort(improc::VerifyEffort::kPure).ToString(),"Pure");
+    EXPECT_EQ(improc::VerifyEffort(improc::VerifyEffort::kRobust).ToString(),"Robust");
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <improc/drawer/engine/worker_pool.hpp>
+
+#include <atomic>
+#include <numeric>
+
+TEST(WorkerPool,TestConstructor) {
+    EXPECT_NO_THROW(improc::WorkerPool());
+    EXPECT_GE(improc::WorkerPool().get_number_workers(),1);
+    EXPECT_EQ(improc::WorkerPool(3).get_number_workers(),3);
+}
+
+TEST(WorkerPool,TestInvalidNumberWorkers) {
+    EXPECT_THROW(improc::WorkerPool(0),improc::value_error);
+}
+
+TEST(WorkerPool,TestRunAllTasks) {
+    improc::WorkerPool worker_pool {4};
+    std::vector<size_t> results (1000,0);
+    worker_pool.Run(results.size(),[&results] (size_t task_idx) {results[task_idx] = task_idx + 1;});
+    for (size_t idx = 0; idx < results.size(); idx++)
+    {
+        EXPECT_EQ(results[idx],idx + 1);
+    }
+}
+
+TEST(WorkerPool,TestDefaultWorkerPool) {
+    improc::WorkerPool& worker_pool = improc::WorkerPool::GetDefault();
+    EXPECT_EQ(&worker_pool,&improc::WorkerPool::GetDefault());
+    EXPECT_GE(worker_pool.get_number_workers(),1);
+    std::atomic<size_t> counter {0};
+    worker_pool.Run(16,[&counter] (size_t) {counter++;});
+    EXPECT_EQ(counter.load(),16);
+}
+
+TEST(WorkerPool,TestRunNested) {
+    improc::WorkerPool worker_pool {2};
+    std::atomic<size_t> counter {0};
+    worker_pool.Run(8,[&worker_pool,&counter] (size_t) 
+        {
+            worker_pool.Run(8,[&counter] (size_t) {counter++;});
+        }
+    );
+    EXPECT_EQ(counter.load(),64);
+}
+
+TEST(WorkerPool,TestRunWithException) {
+    improc::WorkerPool worker_pool {4};
+    std::atomic<size_t> counter {0};
+    EXPECT_THROW(worker_pool.Run(100,[&counter] (size_t task_idx) 
+                    {
+                        counter++;
+                        if (task_idx == 10)
+                        {
+                            throw improc::value_error("Task failed");
+                        }
+                    }
+                ),improc::value_error);
+    EXPECT_EQ(counter.load(),100);
+}